@@ -38,3 +38,16 @@ void arch_sched_broadcast_ipi(void)
 {
 	z_loapic_ipi(0, LOAPIC_ICR_IPI_OTHERS, CONFIG_SCHED_IPI_VECTOR);
 }
+
+void arch_sched_directed_ipi(uint32_t cpu_bitmap)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int id = arch_curr_cpu()->id;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if ((i != id) && ((cpu_bitmap & BIT(i)) != 0U)) {
+			z_loapic_ipi(x86_cpu_loapics[i], LOAPIC_ICR_IPI_SPECIFIC,
+				     CONFIG_SCHED_IPI_VECTOR);
+		}
+	}
+}
@@ -224,6 +224,16 @@ static const struct paging_level paging_levels[] = {
  */
 #define NUM_PT	((PT_END - PT_START) / PT_AREA)
 
+/* On x86_64, regions aligned on PT_AREA both virtually and physically are
+ * mapped with large pages in the page directory. This is only done if the
+ * kernel's page tables are the only ones, as the page tables replaced by
+ * large pages are kept aside for them alone.
+ */
+#if defined(CONFIG_X86_64) && \
+	(!defined(CONFIG_USERSPACE) || defined(CONFIG_X86_COMMON_PAGE_TABLE))
+#define LARGE_PAGES
+#endif
+
 #if defined(CONFIG_X86_64) || defined(CONFIG_X86_PAE)
 /* Same semantics as above, but for the page directories needed to cover
  * system RAM.
@@ -969,6 +979,207 @@ static inline pentry_t pte_atomic_update(pentry_t *pte, pentry_t update_val,
 	return old_val;
 }
 
+#ifdef LARGE_PAGES
+/* Page tables replaced by large pages, one slot per PDE covering the address
+ * space. All page tables are allocated up front, so these are linked back in
+ * the PDE when the large page is split or unmapped.
+ */
+__pinned_bss
+static pentry_t *large_page_ptables[NUM_PT];
+
+/* Slot in large_page_ptables[] for the PDE mapping virt, NULL if none */
+__pinned_func
+static pentry_t **large_page_ptable_slot(void *virt)
+{
+	uintptr_t addr = (uintptr_t)virt;
+
+	if ((addr < PT_START) || (addr >= PT_END)) {
+		return NULL;
+	}
+
+	return &large_page_ptables[(addr - PT_START) / PT_AREA];
+}
+
+/* Get the PDE for virt, or NULL if a table level above it is missing */
+__pinned_func
+static pentry_t *pde_ptr_get(pentry_t *ptables, void *virt)
+{
+	pentry_t *table = ptables;
+
+	for (int level = 0; level < PDE_LEVEL; level++) {
+		pentry_t entry = get_entry(table, virt, level);
+
+		if (((entry & MMU_P) == 0U) || is_leaf(level, entry)) {
+			return NULL;
+		}
+		table = next_table(entry, level);
+	}
+
+	return get_entry_ptr(table, virt, PDE_LEVEL);
+}
+
+/* Whether the region spans the whole scope of a PDE, and so may have been
+ * mapped or unmapped with a large page
+ */
+__pinned_func
+static inline bool large_page_spanned(void *virt, size_t size)
+{
+	uintptr_t start = ROUND_UP((uintptr_t)virt, PT_AREA);
+
+	return ((start - (uintptr_t)virt) + PT_AREA) <= size;
+}
+
+/**
+ * Split a large page mapping
+ *
+ * The PDE is linked back to the page table the large page replaced, whose
+ * PTEs are set to map the same memory with the same flags, or cleared.
+ *
+ * @param pde Entry holding a large page mapping
+ * @param virt Virtual address within the large page
+ * @param level Paging level of the entry
+ * @param clear Clear the PTEs, unmapping the large page
+ *
+ * @return Page table now linked in the PDE, or NULL if the large page was not
+ *         set up by large_page_update()
+ */
+__pinned_func
+static pentry_t *large_page_split(pentry_t *pde, void *virt, int level,
+				  bool clear)
+{
+	pentry_t **slot = large_page_ptable_slot(virt);
+	pentry_t *table;
+	uintptr_t phys;
+	pentry_t flags;
+
+	if ((level != PDE_LEVEL) || (slot == NULL) || (*slot == NULL)) {
+		return NULL;
+	}
+
+	table = *slot;
+	phys = get_entry_phys(*pde, PDE_LEVEL);
+	flags = *pde & ~(paging_levels[PDE_LEVEL].mask | MMU_PS);
+
+	for (size_t i = 0; i < get_num_entries(PTE_LEVEL); i++) {
+		if (clear) {
+			table[i] = 0;
+		} else {
+			table[i] = (pentry_t)(phys + (i * CONFIG_MMU_PAGE_SIZE)) |
+				   flags;
+		}
+	}
+
+	*pde = (pentry_t)k_mem_phys_addr(table) | INT_FLAGS;
+	*slot = NULL;
+
+	/* Also invalidates the cached paging structures */
+	tlb_flush_page(virt);
+
+	return table;
+}
+
+/**
+ * Map or unmap a whole PDE scope with a large page
+ *
+ * A region is mapped with a large page if all its PTE bits are set, it is
+ * present, and both virt and phys are aligned on the PDE scope. Unmapping a
+ * large page links the page table it replaced back in the PDE, cleared.
+ *
+ * See range_map_ptables() for the parameters.
+ *
+ * @retval true if the PDE scope at virt was updated
+ * @retval false if the PTEs must be updated instead
+ */
+__pinned_func
+static bool large_page_update(pentry_t *ptables, void *virt, uintptr_t phys,
+			      size_t size, pentry_t entry_flags, pentry_t mask,
+			      uint32_t options)
+{
+	pentry_t **slot = large_page_ptable_slot(virt);
+	pentry_t *pde;
+
+	if ((size < PT_AREA) || (((uintptr_t)virt & (PT_AREA - 1)) != 0U) ||
+	    (slot == NULL)) {
+		return false;
+	}
+
+	pde = pde_ptr_get(ptables, virt);
+	if ((pde == NULL) || ((*pde & MMU_P) == 0U)) {
+		return false;
+	}
+
+	if ((options & OPTION_CLEAR) != 0U) {
+		return ((*pde & MMU_PS) != 0U) &&
+		       (large_page_split(pde, virt, PDE_LEVEL, true) != NULL);
+	}
+
+	if ((mask != MASK_ALL) || ((options & OPTION_RESET) != 0U) ||
+	    ((entry_flags & MMU_P) == 0U) || ((phys & (PT_AREA - 1)) != 0U)) {
+		return false;
+	}
+
+	if ((*pde & MMU_PS) == 0U) {
+		*slot = next_table(*pde, PDE_LEVEL);
+	} else if (*slot == NULL) {
+		/* Large page set up at build time, we can't replace it */
+		return false;
+	}
+
+	*pde = (pentry_t)phys | entry_flags | MMU_PS;
+
+	/* Invalidates the cached paging structures, and the TLB entries of
+	 * the PTEs replaced if they were present
+	 */
+	tlb_flush_page(virt);
+	if ((options & OPTION_FLUSH) != 0U) {
+		for (size_t offset = CONFIG_MMU_PAGE_SIZE; offset < PT_AREA;
+		     offset += CONFIG_MMU_PAGE_SIZE) {
+			tlb_flush_page((uint8_t *)virt + offset);
+		}
+	}
+
+	return true;
+}
+#else
+__pinned_func
+static inline bool large_page_spanned(void *virt, size_t size)
+{
+	ARG_UNUSED(virt);
+	ARG_UNUSED(size);
+
+	return false;
+}
+
+__pinned_func
+static inline pentry_t *large_page_split(pentry_t *pde, void *virt, int level,
+					 bool clear)
+{
+	ARG_UNUSED(pde);
+	ARG_UNUSED(virt);
+	ARG_UNUSED(level);
+	ARG_UNUSED(clear);
+
+	return NULL;
+}
+
+__pinned_func
+static inline bool large_page_update(pentry_t *ptables, void *virt,
+				     uintptr_t phys, size_t size,
+				     pentry_t entry_flags, pentry_t mask,
+				     uint32_t options)
+{
+	ARG_UNUSED(ptables);
+	ARG_UNUSED(virt);
+	ARG_UNUSED(phys);
+	ARG_UNUSED(size);
+	ARG_UNUSED(entry_flags);
+	ARG_UNUSED(mask);
+	ARG_UNUSED(options);
+
+	return false;
+}
+#endif /* LARGE_PAGES */
+
 /**
  * Low level page table update function for a virtual page
  *
@@ -997,8 +1208,11 @@ static inline pentry_t pte_atomic_update(pentry_t *pte, pentry_t update_val,
  *        OPTION_CLEAR)
  * @param options Control options, described above
  *
+ * Large pages set up by range_map_ptables() are split first.
+ *
  * @retval 0 if successful
- * @retval -EFAULT if large page encountered or missing page table level
+ * @retval -EFAULT if large page that can't be split encountered or missing
+ *         page table level
  */
 __pinned_func
 static int page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
@@ -1026,17 +1240,23 @@ static int page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
 		}
 
 		/* We bail out early here due to no support for
-		 * splitting existing bigpage mappings.
+		 * splitting bigpage mappings other than the ones made
+		 * by range_map_ptables().
 		 * If the PS bit is not supported at some level (like
 		 * in a PML4 entry) it is always reserved and must be 0
 		 */
-		CHECKIF(!((*entryp & MMU_PS) == 0U)) {
-			/* Cannot continue since we cannot split
-			 * bigpage mappings.
-			 */
-			LOG_ERR("large page encountered");
-			ret = -EFAULT;
-			goto out;
+		if ((*entryp & MMU_PS) != 0U) {
+			table = large_page_split(entryp, virt, level, false);
+
+			CHECKIF(!(table != NULL)) {
+				/* Cannot continue since we cannot split
+				 * this bigpage mapping.
+				 */
+				LOG_ERR("large page encountered");
+				ret = -EFAULT;
+				goto out;
+			}
+			continue;
 		}
 
 		table = next_table(*entryp, level);
@@ -1061,6 +1281,46 @@ out:
 	return ret;
 }
 
+/**
+ * Get the page table holding the PTE for a virtual page
+ *
+ * @param ptables Page tables to walk
+ * @param virt Virtual page address
+ *
+ * @return Page table, or NULL if large page that can't be split encountered
+ *         or missing page table level
+ */
+__pinned_func
+static pentry_t *pte_table_get(pentry_t *ptables, void *virt)
+{
+	pentry_t *table = ptables;
+
+	for (int level = 0; level < PTE_LEVEL; level++) {
+		pentry_t *entryp = get_entry_ptr(table, virt, level);
+
+		/* Same restrictions as page_map_set() */
+		if ((*entryp & MMU_PS) != 0U) {
+			table = large_page_split(entryp, virt, level, false);
+
+			CHECKIF(!(table != NULL)) {
+				LOG_ERR("large page encountered");
+				return NULL;
+			}
+			continue;
+		}
+
+		table = next_table(*entryp, level);
+
+		CHECKIF(!(table != NULL)) {
+			LOG_ERR("missing page table level %d when trying to map %p",
+				level + 1, virt);
+			return NULL;
+		}
+	}
+
+	return table;
+}
+
 /**
  * Map a physical region in a specific set of page tables.
  *
@@ -1074,6 +1334,9 @@ out:
  *
  * It is permitted to set up mappings without the Present bit set.
  *
+ * Parts of the region covering whole PDEs may be mapped, or unmapped, with
+ * large pages, see large_page_update().
+ *
  * @param ptables Page tables to modify
  * @param virt Base page-aligned virtual memory address to map the region.
  * @param phys Base page-aligned physical memory address for the region.
@@ -1097,7 +1360,7 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 			     uint32_t options)
 {
 	bool zero_entry = (options & (OPTION_RESET | OPTION_CLEAR)) != 0U;
-	int ret = 0, ret2;
+	int ret = 0;
 
 	CHECKIF(!is_addr_aligned(phys) || !is_size_aligned(size)) {
 		ret = -EINVAL;
@@ -1111,25 +1374,51 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 		goto out;
 	}
 
-	/* This implementation is stack-efficient but not particularly fast.
-	 * We do a full page table walk for every page we are updating.
-	 * Recursive approaches are possible, but use much more stack space.
+	/* This implementation is stack-efficient: we walk the page tables
+	 * down to the page table of the first page to update, then update
+	 * all its PTEs within the region before walking down to the next
+	 * page table. Recursive approaches are possible, but use much more
+	 * stack space.
 	 */
-	for (size_t offset = 0; offset < size; offset += CONFIG_MMU_PAGE_SIZE) {
+	for (size_t offset = 0; offset < size; ) {
 		uint8_t *dest_virt = (uint8_t *)virt + offset;
-		pentry_t entry_val;
+		pentry_t *table;
+		size_t index;
 
-		if (zero_entry) {
-			entry_val = 0;
-		} else {
-			entry_val = (pentry_t)(phys + offset) | entry_flags;
+		if (large_page_update(ptables, dest_virt, phys + offset,
+				      size - offset, entry_flags, mask,
+				      options)) {
+			offset += PT_AREA;
+			continue;
 		}
 
-		ret2 = page_map_set(ptables, dest_virt, entry_val, NULL, mask,
-				   options);
-		ARG_UNUSED(ret2);
-		CHECKIF(ret2 != 0) {
-			ret = ret2;
+		table = pte_table_get(ptables, dest_virt);
+		index = get_index(dest_virt, PTE_LEVEL);
+
+		CHECKIF(table == NULL) {
+			ret = -EFAULT;
+		}
+
+		for (; (index < get_num_entries(PTE_LEVEL)) && (offset < size);
+		     index++, offset += CONFIG_MMU_PAGE_SIZE) {
+			pentry_t entry_val;
+
+			if (table == NULL) {
+				/* Skip the pages of the missing page table */
+				continue;
+			}
+
+			if (zero_entry) {
+				entry_val = 0;
+			} else {
+				entry_val = (pentry_t)(phys + offset) | entry_flags;
+			}
+
+			(void)pte_atomic_update(&table[index], entry_val, mask,
+						options);
+			if ((options & OPTION_FLUSH) != 0U) {
+				tlb_flush_page((uint8_t *)virt + offset);
+			}
 		}
 	}
 
@@ -1222,7 +1511,11 @@ static int range_map(void *virt, uintptr_t phys, size_t size,
 
 out:
 #ifdef CONFIG_SMP
-	if ((options & OPTION_FLUSH) != 0U) {
+	/* Large pages mapped or unmapped change PDEs other CPUs may have
+	 * cached, even for new mappings
+	 */
+	if (((options & OPTION_FLUSH) != 0U) ||
+	    large_page_spanned(virt, size)) {
 		tlb_shootdown();
 	}
 #endif /* CONFIG_SMP */
@@ -1313,6 +1606,19 @@ void arch_mem_unmap(void *addr, size_t size)
 	ARG_UNUSED(ret);
 }
 
+#ifdef LARGE_PAGES
+/* Align regions which may be mapped with large pages */
+__pinned_func
+size_t arch_virt_region_align(uintptr_t phys, size_t size)
+{
+	if ((size >= PT_AREA) && ((phys & (PT_AREA - 1)) == 0U)) {
+		return PT_AREA;
+	}
+
+	return CONFIG_MMU_PAGE_SIZE;
+}
+#endif /* LARGE_PAGES */
+
 #ifdef K_MEM_IS_VM_KERNEL
 __boot_func
 static void identity_map_remove(uint32_t level)
@@ -2075,7 +2381,9 @@ int arch_page_phys_get(void *virt, uintptr_t *phys)
 
 	if ((pte & MMU_P) != 0) {
 		if (phys != NULL) {
-			*phys = (uintptr_t)get_entry_phys(pte, PTE_LEVEL);
+			/* Large pages map the whole scope of the entry */
+			*phys = (uintptr_t)get_entry_phys(pte, level) +
+				((uintptr_t)virt & (get_entry_scope(level) - 1));
 		}
 		ret = 0;
 	} else {
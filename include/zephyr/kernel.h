@@ -1958,6 +1958,14 @@ struct k_queue {
 	sys_sflist_t data_q;
 	struct k_spinlock lock;
 	_wait_q_t wait_q;
+#ifdef CONFIG_QUEUE_LOCKFREE
+	/* Items appended without the lock, newest first */
+	atomic_ptr_t inbox;
+	/* Threads pended or about to pend in k_queue_get() */
+	atomic_t waiters;
+	/* Set once the queue has been k_poll()ed */
+	atomic_t polled;
+#endif
 
 	Z_DECL_POLL_EVENT
 
@@ -2196,6 +2204,11 @@ __syscall int k_queue_is_empty(struct k_queue *queue);
 
 static inline int z_impl_k_queue_is_empty(struct k_queue *queue)
 {
+#ifdef CONFIG_QUEUE_LOCKFREE
+	if (atomic_ptr_get(&queue->inbox) != NULL) {
+		return 0;
+	}
+#endif
 	return sys_sflist_is_empty(&queue->data_q) ? 1 : 0;
 }
 
@@ -3005,6 +3018,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3215,6 +3229,175 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @}
  */
 
+/**
+ * @defgroup rwlock_apis Reader/Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * Reader/writer lock statistics
+ * @ingroup rwlock_apis
+ */
+struct k_rwlock_stats {
+	/** Number of times the lock was taken for reading */
+	uint32_t read_locks;
+	/** Number of read locks that had to wait for the lock */
+	uint32_t read_contended;
+	/** Number of times the lock was taken for writing */
+	uint32_t write_locks;
+	/** Number of write locks that had to wait for the lock */
+	uint32_t write_contended;
+	/** Highest number of concurrent readers */
+	uint32_t max_readers;
+};
+
+/**
+ * Reader/writer lock structure
+ * @ingroup rwlock_apis
+ */
+struct k_rwlock {
+	/** Readers waiting for the lock */
+	_wait_q_t read_wait_q;
+	/** Writers waiting for the lock */
+	_wait_q_t write_wait_q;
+	/** Writer holding the lock, or NULL */
+	struct k_thread *writer;
+	/** Number of readers holding the lock */
+	uint32_t readers;
+	/** Original priority of the writer */
+	int writer_orig_prio;
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	struct k_rwlock_stats stats;
+#endif
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	struct k_obj_core obj_core;
+#endif
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#define Z_RWLOCK_INITIALIZER(obj) \
+	{ \
+	.read_wait_q = Z_WAIT_Q_INIT(&(obj).read_wait_q), \
+	.write_wait_q = Z_WAIT_Q_INIT(&(obj).write_wait_q), \
+	.writer = NULL, \
+	.readers = 0, \
+	.writer_orig_prio = K_LOWEST_APPLICATION_THREAD_PRIO, \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a reader/writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader/writer lock.
+ */
+#define K_RWLOCK_DEFINE(name) \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) = \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @brief Initialize a reader/writer lock.
+ *
+ * This routine initializes a reader/writer lock object, prior to its first
+ * use.
+ *
+ * @param rwlock Address of the reader/writer lock.
+ *
+ * @retval 0 Reader/writer lock object created
+ */
+__syscall int k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader/writer lock for reading.
+ *
+ * Any number of threads may hold the lock for reading at the same time.
+ * The calling thread waits while the lock is held for writing, or while a
+ * writer is waiting for it: writers are preferred over new readers.
+ * Consequently a thread must not lock the same lock for reading twice.
+ *
+ * With CONFIG_RWLOCK_PRIORITY_INHERITANCE, a waiting thread lends its
+ * priority to the writer holding the lock, if any. Readers holding the
+ * lock do not inherit priorities.
+ *
+ * Reader/writer locks may not be locked in ISRs.
+ *
+ * @param rwlock Address of the reader/writer lock.
+ * @param timeout Waiting period to lock the reader/writer lock,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Lock taken for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The calling thread holds the lock for writing.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader/writer lock held for reading.
+ *
+ * When the last reader releases the lock, the highest priority waiting
+ * writer, if any, takes it.
+ *
+ * @param rwlock Address of the reader/writer lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EINVAL The lock is not held for reading.
+ */
+__syscall int k_rwlock_read_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader/writer lock for writing.
+ *
+ * The calling thread waits until no other thread holds the lock, either
+ * for reading or for writing. Locking is not recursive.
+ *
+ * With CONFIG_RWLOCK_PRIORITY_INHERITANCE, a waiting thread lends its
+ * priority to the writer holding the lock, if any.
+ *
+ * Reader/writer locks may not be locked in ISRs.
+ *
+ * @param rwlock Address of the reader/writer lock.
+ * @param timeout Waiting period to lock the reader/writer lock,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Lock taken for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The calling thread already holds the lock for writing.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader/writer lock held for writing.
+ *
+ * The lock is handed to the highest priority waiting writer if there is
+ * one, otherwise all waiting readers take it at once.
+ *
+ * @param rwlock Address of the reader/writer lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EPERM The current thread does not hold the lock for writing.
+ * @retval -EINVAL The lock is not held for writing.
+ */
+__syscall int k_rwlock_write_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @}
+ */
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -3456,6 +3639,33 @@ static inline bool k_work_is_pending(const struct k_work *work);
 int k_work_submit_to_queue(struct k_work_q *queue,
 			   struct k_work *work);
 
+/** @brief Submit a work item to a queue, preferring a CPU.
+ *
+ * Same as k_work_submit_to_queue(), but on a work queue pool the item is
+ * queued to the worker that was added for @p cpu with
+ * k_work_queue_add_worker(), so that it runs where its data is likely to be
+ * cached.  The preference is not binding: an idle worker steals the item
+ * rather than leave it waiting.
+ *
+ * If no worker of @p queue was added for @p cpu, or @p cpu is negative, the
+ * item is queued exactly as by k_work_submit_to_queue().
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_POOL}
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue pointer to the work queue on which the item should run.  If
+ * NULL the queue from the most recent submission will be used.
+ *
+ * @param work pointer to the work item.
+ *
+ * @param cpu the preferred CPU.
+ *
+ * @return as with k_work_submit_to_queue().
+ */
+int k_work_submit_to_queue_cpu(struct k_work_q *queue,
+			       struct k_work *work, int cpu);
+
 /** @brief Submit a work item to the system queue.
  *
  * @funcprops \isr_ok
@@ -3591,6 +3801,44 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue);
 
+/** @brief Add a worker thread to a work queue, making it a pool.
+ *
+ * A work queue with added workers processes up to one item per worker
+ * thread at the same time.  A work item is still never run by two workers at
+ * once: an item that is resubmitted while its handler runs is only picked up
+ * once that handler returns.
+ *
+ * The worker takes the priority, name and @c no_yield and @c essential
+ * configuration of the queue thread.  If @p cpu is not negative the worker
+ * takes work submitted for that CPU with k_work_submit_to_queue_cpu()
+ * before any other, and with CONFIG_SCHED_CPU_MASK it is pinned to the CPU.
+ *
+ * Workers should be added before work is submitted to the queue, and must
+ * be added again if the queue is restarted after k_work_queue_stop().
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_POOL}
+ *
+ * @param queue pointer to a queue started with k_work_queue_start().
+ *
+ * @param worker pointer to the worker structure.  It must persist until the
+ * queue is stopped.
+ *
+ * @param stack pointer to the worker thread stack area.
+ *
+ * @param stack_size size of the worker thread stack area, in bytes.
+ *
+ * @param cpu the CPU the worker serves, or -1 for any.
+ *
+ * @retval 0 if the worker was added
+ * @retval -ENODEV if @p queue has not been started
+ * @retval -EBUSY if @p queue is being stopped
+ * @retval -EINVAL if @p cpu is not a valid CPU
+ */
+int k_work_queue_add_worker(struct k_work_q *queue,
+			    struct k_work_q_worker *worker,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int cpu);
+
 /** @brief Wait until the work queue has drained, optionally plugging it.
  *
  * This blocks submission to the work queue except when coming from queue
@@ -3637,6 +3885,13 @@ int k_work_queue_unplug(struct k_work_q *queue);
  * This call is blocking and guarantees that the work queue thread has terminated
  * cleanly if successful, no work will be processed past this point.
  *
+ * If the queue does not stop within @p timeout, a single thread queue keeps
+ * running as before.  A pool, which may have lost some of its threads by then,
+ * keeps stopping instead: it stays plugged, its remaining threads exit once
+ * done with their work, and it can neither be given new workers nor be
+ * started again until it has stopped.  Calling k_work_queue_stop() again waits
+ * for that.
+ *
  * @param queue Pointer to the queue structure.
  * @param timeout Maximum time to wait for the work queue to stop.
  *
@@ -3842,6 +4097,35 @@ int k_work_reschedule_for_queue(struct k_work_q *queue,
 int k_work_reschedule(struct k_work_delayable *dwork,
 				     k_timeout_t delay);
 
+/** @brief Reschedule a batch of work items to a queue.
+ *
+ * Same as calling k_work_reschedule_for_queue() on each item, but the work
+ * lock and the timeout lock are each taken once and the new deadlines are
+ * merged into the timeout queue in a single pass.  This makes it much
+ * cheaper to move the deadlines of many items at once, e.g. when a
+ * connection manager restarts its timers.
+ *
+ * An item must not appear more than once in @p dworks.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue the queue on which the work items should be submitted after
+ * their delays.
+ *
+ * @param dworks array of pointers to the delayable work items.
+ *
+ * @param delays array of the time to wait before submitting each work item,
+ * as with k_work_reschedule_for_queue().
+ *
+ * @param count the number of entries in @p dworks and @p delays.
+ *
+ * @return the number of work items that were scheduled, or that were
+ * submitted because their delay was @c K_NO_WAIT.
+ */
+int k_work_reschedule_batch(struct k_work_q *queue,
+			    struct k_work_delayable *const *dworks,
+			    const k_timeout_t *delays, size_t count);
+
 /** @brief Flush delayable work.
  *
  * If the work is scheduled, it is immediately submitted.  Then the caller
@@ -3891,6 +4175,24 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
  */
 int k_work_cancel_delayable(struct k_work_delayable *dwork);
 
+/** @brief Cancel a batch of delayable work items.
+ *
+ * Same as calling k_work_cancel_delayable() on each item, but the work lock
+ * and the timeout lock are each taken once for the whole batch.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dworks array of pointers to the delayable work items.
+ *
+ * @param count the number of entries in @p dworks.
+ *
+ * @return the number of work items that are still busy after all
+ * cancellation steps performed by this call are completed, i.e. for which
+ * k_work_cancel_delayable() would have returned a non-zero value.
+ */
+int k_work_cancel_delayable_batch(struct k_work_delayable *const *dworks,
+				  size_t count);
+
 /** @brief Cancel delayable work and wait.
  *
  * Like k_work_cancel_delayable() but waits until the work becomes idle.
@@ -4174,6 +4476,38 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Workers added with k_work_queue_add_worker(). */
+	sys_slist_t workers;
+
+	/* Number of threads running a work item. */
+	uint16_t nr_busy;
+
+	/* Number of threads that have not exited after a stop. */
+	uint16_t nr_threads;
+#endif /* CONFIG_WORKQUEUE_POOL */
+};
+
+/** @brief A structure holding an additional thread of a work queue pool.
+ *
+ * @see k_work_queue_add_worker()
+ */
+struct k_work_q_worker {
+	/* The thread that animates the work. */
+	struct k_thread thread;
+
+	/* Node in the workers list of the queue. */
+	sys_snode_t node;
+
+	/* The queue served by the worker. */
+	struct k_work_q *queue;
+
+	/* List of k_work items submitted for the CPU of this worker. */
+	sys_slist_t pending;
+
+	/* The CPU served by the worker, or -1. */
+	int cpu;
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4568,6 +4902,21 @@ struct k_msgq {
 	char *write_ptr;
 	/** Number of used messages */
 	uint32_t used_msgs;
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	/** Slot handed out by k_msgq_reserve(), or NULL */
+	char *reserve_ptr;
+	/** Slot handed out by k_msgq_claim(), or NULL */
+	char *claim_ptr;
+	/** Number of messages put behind the reserved slot */
+	uint32_t pending_msgs;
+	/** Number of slots from the claimed slot up to the read pointer */
+	uint32_t held_msgs;
+	/** Threads waiting to put or reserve; wait_q then only holds
+	 * threads waiting to get or claim, as a reserved slot lets both
+	 * wait at once
+	 */
+	_wait_q_t write_wait_q;
+#endif
 
 	Z_DECL_POLL_EVENT
 
@@ -4584,10 +4933,17 @@ struct k_msgq {
  * @cond INTERNAL_HIDDEN
  */
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+#define Z_MSGQ_WRITE_WAIT_Q_INIT(obj) \
+	.write_wait_q = Z_WAIT_Q_INIT(&obj.write_wait_q),
+#else
+#define Z_MSGQ_WRITE_WAIT_Q_INIT(obj)
+#endif /* CONFIG_MSGQ_ZERO_COPY */
 
 #define Z_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	Z_MSGQ_WRITE_WAIT_Q_INIT(obj) \
 	.msg_size = q_msg_size, \
 	.max_msgs = q_max_msgs, \
 	.buffer_start = q_buffer, \
@@ -4772,6 +5128,98 @@ __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
  */
 __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
 
+/**
+ * @brief Reserve a slot in a message queue to write a message in place.
+ *
+ * This routine hands out a pointer to the next free slot of the message
+ * queue's ring buffer, so that a large message can be built there directly
+ * instead of being copied in by k_msgq_put(). The message is sent when the
+ * slot is passed to k_msgq_commit(). Messages sent with k_msgq_put() while
+ * the slot is reserved are queued behind it and received after it.
+ *
+ * Only one slot of a message queue can be reserved at a time.
+ *
+ * When called from user mode, the calling thread must have write access to
+ * the message queue's ring buffer.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Requires CONFIG_MSGQ_ZERO_COPY.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Address of a pointer that receives the reserved slot.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot reserved.
+ * @retval -EBUSY Another slot is already reserved.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_reserve(struct k_msgq *msgq, void **slot, k_timeout_t timeout);
+
+/**
+ * @brief Send the message written in a reserved slot.
+ *
+ * @note Requires CONFIG_MSGQ_ZERO_COPY.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Slot returned by k_msgq_reserve().
+ *
+ * @retval 0 Message sent.
+ * @retval -EINVAL @a slot is not the reserved slot.
+ */
+__syscall int k_msgq_commit(struct k_msgq *msgq, void *slot);
+
+/**
+ * @brief Claim the next message of a message queue to read it in place.
+ *
+ * This routine receives a message like k_msgq_get(), but rather than
+ * copying it out, hands out a pointer to the message in the queue's ring
+ * buffer. The slot stays unavailable to senders until it is passed to
+ * k_msgq_release(); messages can still be received with k_msgq_get()
+ * meanwhile.
+ *
+ * Only one message of a message queue can be claimed at a time.
+ *
+ * When called from user mode, the calling thread must have read access to
+ * the message queue's ring buffer.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note Requires CONFIG_MSGQ_ZERO_COPY.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Address of a pointer that receives the claimed message.
+ * @param timeout Waiting period to receive the message, or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -EBUSY Another message is already claimed.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout);
+
+/**
+ * @brief Release a claimed message.
+ *
+ * @note Requires CONFIG_MSGQ_ZERO_COPY.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param slot Slot returned by k_msgq_claim().
+ *
+ * @retval 0 Slot released.
+ * @retval -EINVAL @a slot is not the claimed message.
+ */
+__syscall int k_msgq_release(struct k_msgq *msgq, void *slot);
+
 /**
  * @brief Purge a message queue.
  *
@@ -4809,7 +5257,12 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	return msgq->max_msgs - msgq->used_msgs - msgq->pending_msgs -
+	       msgq->held_msgs - ((msgq->reserve_ptr != NULL) ? 1U : 0U);
+#else
 	return msgq->max_msgs - msgq->used_msgs;
+#endif
 }
 
 /**
@@ -5206,6 +5659,21 @@ __deprecated __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 enum pipe_flags {
 	PIPE_FLAG_OPEN = BIT(0),
 	PIPE_FLAG_RESET = BIT(1),
+	PIPE_FLAG_WRITE_CLAIMED = BIT(2),
+	PIPE_FLAG_READ_CLAIMED = BIT(3),
+};
+
+/**
+ * @brief Pipe scatter-gather buffer segment
+ *
+ * Describes one contiguous buffer of a k_pipe_writev() or k_pipe_readv()
+ * transfer.
+ */
+struct k_pipe_iovec {
+	/** Start of the segment */
+	void *base;
+	/** Length of the segment (in bytes) */
+	size_t len;
 };
 
 struct k_pipe {
@@ -5316,6 +5784,152 @@ __syscall void k_pipe_reset(struct k_pipe *pipe);
  * @param pipe Address of the pipe.
  */
 __syscall void k_pipe_close(struct k_pipe *pipe);
+
+/**
+ * @brief Write data from several buffers to a pipe
+ *
+ * This routine writes the concatenation of the @a iovcnt buffers described by
+ * @a iov to @a pipe, with the same semantics as k_pipe_write(). Each buffer is
+ * copied directly to waiting readers or to the pipe's ring buffer, there is no
+ * need to gather them into one buffer first.
+ *
+ * @note Requires CONFIG_PIPE_ZERO_COPY. From user mode, the buffers are
+ *       written in batches of up to 8, other writers may write between
+ *       batches.
+ *
+ * @param pipe Address of the pipe.
+ * @param iov Array of buffers to write.
+ * @param iovcnt Number of entries in @a iov.
+ * @param timeout Waiting period to wait for the data to be written.
+ *
+ * @retval number of bytes written on success
+ * @retval -EAGAIN if no data could be written before the timeout expired
+ * @retval -ECANCELED if the write was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ * @retval -EINVAL if the total length of the buffers does not fit an int
+ */
+__syscall int k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			    size_t iovcnt, k_timeout_t timeout);
+
+/**
+ * @brief Read data from a pipe into several buffers
+ *
+ * This routine fills the @a iovcnt buffers described by @a iov, in order,
+ * with data read from @a pipe, with the same semantics as k_pipe_read().
+ *
+ * @note Requires CONFIG_PIPE_ZERO_COPY. From user mode, the buffers are
+ *       filled in batches of up to 8, other readers may read between
+ *       batches.
+ *
+ * @param pipe Address of the pipe.
+ * @param iov Array of buffers to fill.
+ * @param iovcnt Number of entries in @a iov.
+ * @param timeout Waiting period to wait for the data to be read.
+ *
+ * @retval number of bytes read on success
+ * @retval -EAGAIN if no data could be read before the timeout expired
+ * @retval -ECANCELED if the read was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ * @retval -EINVAL if the total length of the buffers does not fit an int
+ */
+__syscall int k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+			   size_t iovcnt, k_timeout_t timeout);
+
+/**
+ * @brief Claim space in a pipe's ring buffer for writing in place
+ *
+ * This routine hands out up to @a len bytes of contiguous free space of the
+ * pipe's ring buffer. The caller writes its data there, then commits it with
+ * k_pipe_write_finish(). If the ring buffer is full, the routine blocks until
+ * space is freed or the timeout expires.
+ *
+ * Less than @a len bytes may be claimed when the free space wraps around the
+ * end of the ring buffer. Only one write claim may be outstanding at a time:
+ * k_pipe_write() and k_pipe_writev() wait for it to be finished.
+ *
+ * @note Requires CONFIG_PIPE_ZERO_COPY. From user mode, the calling thread
+ *       must have write access to the pipe's ring buffer.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the address of the claimed space.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for space to be available.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no space was available before the timeout expired
+ * @retval -EBUSY if a write claim is already outstanding
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed
+ * @retval -EINVAL if @a len is zero or the pipe has no ring buffer
+ */
+__syscall int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+				 k_timeout_t timeout);
+
+/**
+ * @brief Commit data written in place to a pipe
+ *
+ * This routine makes the first @a len bytes of the space claimed with
+ * k_pipe_write_claim() available to readers, and gives back the rest of the
+ * claimed space. The claim ends, even if @a len is zero.
+ *
+ * @note Requires CONFIG_PIPE_ZERO_COPY.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes written to the claimed space.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no write claim is outstanding, it was invalidated by
+ *         k_pipe_reset(..), or @a len is larger than the claimed space
+ */
+__syscall int k_pipe_write_finish(struct k_pipe *pipe, size_t len);
+
+/**
+ * @brief Claim data in a pipe's ring buffer for reading in place
+ *
+ * This routine hands out up to @a len bytes of contiguous data of the pipe's
+ * ring buffer. The caller reads the data there, then frees it with
+ * k_pipe_read_finish(). If the ring buffer is empty, the routine blocks until
+ * data is written or the timeout expires.
+ *
+ * Less than @a len bytes may be claimed when the data wraps around the end of
+ * the ring buffer. Only one read claim may be outstanding at a time:
+ * k_pipe_read() and k_pipe_readv() wait for it to be finished.
+ *
+ * @note Requires CONFIG_PIPE_ZERO_COPY. From user mode, the calling thread
+ *       must have read access to the pipe's ring buffer.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the address of the claimed data.
+ * @param len Requested number of bytes.
+ * @param timeout Waiting period to wait for data to be available.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no data was available before the timeout expired
+ * @retval -EBUSY if a read claim is already outstanding
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EPIPE if the pipe was closed and is empty
+ * @retval -EINVAL if @a len is zero or the pipe has no ring buffer
+ */
+__syscall int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+				k_timeout_t timeout);
+
+/**
+ * @brief Free data read in place from a pipe
+ *
+ * This routine frees the first @a len bytes of the data claimed with
+ * k_pipe_read_claim(), making room for writers. The rest of the claimed data
+ * stays in the pipe, to be read again. The claim ends, even if @a len is zero.
+ *
+ * @note Requires CONFIG_PIPE_ZERO_COPY.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes consumed from the claimed data.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no read claim is outstanding, it was invalidated by
+ *         k_pipe_reset(..), or @a len is larger than the claimed data
+ */
+__syscall int k_pipe_read_finish(struct k_pipe *pipe, size_t len);
 #endif /* CONFIG_PIPES */
 /** @} */
 
@@ -5331,6 +5945,15 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Per-CPU magazine of free blocks, linked through the blocks themselves */
+struct k_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t count;
+};
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5343,6 +5966,12 @@ struct k_mem_slab {
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* Threads about to pend or pended on wait_q */
+	atomic_t waiters;
+	struct k_mem_slab_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
 #define Z_MEM_SLAB_INITIALIZER(_slab, _slab_buffer, _slab_block_size, \
@@ -5491,7 +6120,18 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* Blocks sitting in the per-CPU caches are free, not used */
+	uint32_t cached = 0U;
+
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->cpu_cache[i].count;
+	}
+
+	return slab->info.num_used - MIN(cached, slab->info.num_used);
+#else
 	return slab->info.num_used;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 }
 
 /**
@@ -5526,7 +6166,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -6167,6 +6807,141 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+#if defined(CONFIG_POLL_SET) || defined(__DOXYGEN__)
+
+/* public - values for the flags of k_poll_set_add() and k_poll_set_modify() */
+
+/** Report the entry when its object is signaled, not while it stays ready */
+#define K_POLL_SET_EDGE BIT(0)
+/** Stop reporting the entry after it was reported once */
+#define K_POLL_SET_ONESHOT BIT(1)
+
+/**
+ * @brief Poll set
+ *
+ * A persistent set of poll events, see k_poll_set_init().
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Poll set entry
+ *
+ * Initialize @a event with k_poll_event_init() before adding the entry to a
+ * poll set. When the entry is returned by k_poll_set_wait(), the state field
+ * of @a event holds the K_POLL_STATE_xxx values found.
+ */
+struct k_poll_set_entry {
+	/** The event to watch */
+	struct k_poll_event event;
+
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dnode_t ready_node;
+
+	/** PRIVATE - DO NOT TOUCH */
+	uint32_t flags;
+
+	/** PRIVATE - DO NOT TOUCH */
+	uint32_t pending;
+};
+
+/**
+ * @brief Initialize a poll set
+ *
+ * Unlike k_poll(), which registers all of its events with their objects on
+ * every call and removes them again before returning, a poll set keeps its
+ * entries registered until they are removed. Objects queue their entries on
+ * the set's ready list when they are signaled, so the cost of a wait depends
+ * on the number of ready entries, not on the number of entries in the set.
+ *
+ * Poll sets are not available to user mode threads.
+ *
+ * @param set The poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an entry to a poll set
+ *
+ * By default entries are level-triggered: an entry is reported by every
+ * k_poll_set_wait() for as long as its condition is met. With
+ * K_POLL_SET_EDGE it is reported once each time its object is signaled,
+ * and with K_POLL_SET_ONESHOT only once until it is re-armed with
+ * k_poll_set_modify(). An entry whose condition is already met is reported
+ * by the next wait in all modes.
+ *
+ * @param set The poll set.
+ * @param entry The entry, with an initialized event of a type other than
+ *              K_POLL_TYPE_IGNORE.
+ * @param flags K_POLL_SET_EDGE and/or K_POLL_SET_ONESHOT, or 0.
+ *
+ * @retval 0 The entry was added.
+ * @retval -EALREADY The entry is already part of a poll set, or its event is
+ *         in use by k_poll().
+ * @retval -EINVAL The event type is not supported.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_set_entry *entry,
+		   uint32_t flags);
+
+/**
+ * @brief Change the mode of a poll set entry and re-arm it
+ *
+ * @param set The poll set.
+ * @param entry An entry of @a set.
+ * @param flags K_POLL_SET_EDGE and/or K_POLL_SET_ONESHOT, or 0.
+ *
+ * @retval 0 The entry was modified.
+ * @retval -EINVAL The entry is not part of @a set.
+ */
+int k_poll_set_modify(struct k_poll_set *set, struct k_poll_set_entry *entry,
+		      uint32_t flags);
+
+/**
+ * @brief Remove an entry from a poll set
+ *
+ * Entries must be removed before their object or the entry itself goes out
+ * of scope.
+ *
+ * @param set The poll set.
+ * @param entry An entry of @a set.
+ *
+ * @retval 0 The entry was removed.
+ * @retval -EINVAL The entry is not part of @a set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_set_entry *entry);
+
+/**
+ * @brief Wait for entries of a poll set to be ready
+ *
+ * As with k_poll(), objects are not taken on behalf of the caller, and a
+ * thread pending on an object takes precedence over the poll set. Entries
+ * are returned in the order they became ready.
+ *
+ * Several threads may wait on the same set; one of them is woken for each
+ * entry that becomes ready.
+ *
+ * @param set The poll set.
+ * @param ready Array that receives the ready entries.
+ * @param max Size of @a ready, at least 1.
+ * @param timeout Waiting period for an entry to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of entries stored in @a ready, or -EAGAIN if the waiting
+ *         period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_set_entry **ready,
+		    int max, k_timeout_t timeout);
+
+#endif /* CONFIG_POLL_SET */
+
 /** @} */
 
 /**
@@ -6396,6 +7171,33 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats);
  */
 int k_thread_runtime_stats_cpu_get(int cpu, k_thread_runtime_stats_t *stats);
 
+/**
+ * @brief Get the scheduler IPI statistics of a CPU
+ *
+ * Only available when CONFIG_SCHED_IPI_STATS is enabled. An IPI is
+ * counted as useful when the CPU switched to another thread when
+ * handling it, and as spurious otherwise.
+ *
+ * @param cpu The cpu number
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if null pointer or invalid cpu, otherwise 0
+ */
+int k_ipi_stats_get(int cpu, struct k_ipi_stats *stats);
+
+/**
+ * @brief Get the load averages of a CPU
+ *
+ * Only available when CONFIG_SCHED_CPU_LOAD is enabled. The load is the
+ * share of time the CPU spent running threads other than its idle thread,
+ * while CPU runtime statistics are enabled, averaged over the last 1, 10
+ * and 60 seconds with exponentially decaying weights.
+ *
+ * @param cpu The cpu number
+ * @param stats Pointer to struct to copy the load averages into.
+ * @return -EINVAL if null pointer or invalid cpu, otherwise 0
+ */
+int k_cpu_load_get(int cpu, struct k_cpu_load_stats *stats);
+
 /**
  * @brief Enable gathering of runtime statistics for specified thread
  *
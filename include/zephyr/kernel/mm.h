@@ -133,6 +133,22 @@ extern "C" {
  */
 #define K_MEM_MAP_UNPAGED	BIT(18)
 
+/**
+ * Region will be backed by physically contiguous page frames
+ *
+ * The page frames are allocated as one run and mapped all at once, aligned
+ * so the architecture may use larger pages to map them where it supports
+ * them. Such regions are always pinned in memory, as with K_MEM_MAP_LOCK,
+ * and are suitable for DMA buffers. This is incompatible with
+ * K_MEM_MAP_UNPAGED.
+ *
+ * Mapping fails if no long enough run of free page frames is available, even
+ * if demand paging could free up some page frames.
+ *
+ * @note Requires CONFIG_MMU_CONTIG_ALLOC, mapping fails otherwise.
+ */
+#define K_MEM_MAP_CONTIG	BIT(19)
+
 /** @} */
 
 /**
@@ -164,9 +180,9 @@ size_t k_mem_free_get(void);
  *
  * Unless K_MEM_MAP_UNINIT is used, the returned memory will be zeroed.
  *
- * The mapped region is not guaranteed to be physically contiguous in memory.
- * Physically contiguous buffers should be allocated statically and pinned
- * at build time.
+ * The mapped region is not guaranteed to be physically contiguous in memory,
+ * unless K_MEM_MAP_CONTIG is used. Otherwise physically contiguous buffers
+ * should be allocated statically and pinned at build time.
  *
  * Pages mapped in this way have write-back cache settings.
  *
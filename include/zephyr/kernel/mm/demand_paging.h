@@ -50,6 +50,11 @@ struct k_mem_paging_stats_t {
 		/** Number of page faults while in ISR */
 		unsigned long			in_isr;
 #endif /* !CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+#if defined(CONFIG_DEMAND_PAGING_READ_AHEAD) || defined(__DOXYGEN__)
+		/** Number of pages read ahead of sequential page faults */
+		unsigned long			read_ahead;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 	} pagefaults;
 
 	struct {
@@ -58,6 +63,21 @@ struct k_mem_paging_stats_t {
 
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
+
+		/**
+		 * Number of page frames the eviction algorithm examined
+		 * to select them
+		 */
+		unsigned long			scanned;
+
+		/**
+		 * Total time spent selecting them, in the same unit as
+		 * the eviction timing histogram
+		 */
+		uint64_t			select_cycles;
+
+		/** Longest time spent selecting one of them */
+		uint32_t			select_cycles_max;
 	} eviction;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
@@ -412,6 +432,29 @@ void k_mem_paging_backing_store_page_out(uintptr_t location);
  */
 void k_mem_paging_backing_store_page_in(uintptr_t location);
 
+/**
+ * Copy several data pages from the provided locations to K_MEM_SCRATCH_AREA.
+ *
+ * This is the batched version of k_mem_paging_backing_store_page_in(), used
+ * to read pages ahead of sequential page faults, which lets the backing store
+ * turn them into a single transfer. The data page at locations[i] is to be
+ * copied to K_MEM_SCRATCH_AREA + i * CONFIG_MMU_PAGE_SIZE.
+ *
+ * Immediately before this is called, these pages of K_MEM_SCRATCH_AREA will
+ * be mapped read-write to the intended destination page frames for the
+ * calling context. k_mem_paging_backing_store_page_finalize() is invoked for
+ * each of them afterwards.
+ *
+ * Only needed with CONFIG_DEMAND_PAGING_READ_AHEAD, which backing stores
+ * implementing it enable with CONFIG_BACKING_STORE_PAGE_IN_BATCH.
+ *
+ * @param locations Location tokens for the data pages
+ * @param count Number of data pages, at most
+ *              CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES
+ */
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations,
+					      size_t count);
+
 /**
  * Update internal accounting after a page-in
  *
@@ -10,6 +10,26 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+/**
+ * Structure used to track the ready-to-run latency of a thread, or of
+ * all threads switched in on a CPU: the time from becoming ready to
+ * running, or from being preempted to running again.
+ *
+ * Bucket N counts the latencies of 2^N to 2^(N+1) - 1 cycles, bucket 0
+ * also counts latencies of 0 cycles and the last bucket all latencies
+ * too long for the others.
+ */
+
+struct k_ready_latency_stats {
+	uint64_t  total;        /**< sum of the latencies, in cycles */
+	uint32_t  count;        /**< \# of latencies recorded */
+	uint32_t  longest;      /**< longest latency, in cycles */
+	/** log2 histogram of the latencies */
+	uint32_t  buckets[CONFIG_SCHED_THREAD_READY_LATENCY_BUCKETS];
+};
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
+
 /**
  * Structure used to track internal statistics about both thread
  * and CPU usage.
@@ -27,7 +47,34 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+	struct k_ready_latency_stats ready_latency; /**< ready-to-run latency */
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+/**
+ * Structure used to report scheduler IPI statistics for a CPU.
+ */
+
+struct k_ipi_stats {
+	uint32_t  sent;         /**< \# of scheduler IPIs sent to the CPU */
+	uint32_t  useful;       /**< \# of handled IPIs that led to a switch */
+	uint32_t  spurious;     /**< \# of handled IPIs that did not */
+};
+
+#ifdef CONFIG_SCHED_CPU_LOAD
+/**
+ * Structure used to report the load of a CPU: the share of its time spent
+ * running threads other than its idle thread, as exponentially weighted
+ * moving averages with time constants of 1, 10 and 60 seconds.
+ */
+
+struct k_cpu_load_stats {
+	uint32_t  avg_1s;       /**< 1 second load average, in permille */
+	uint32_t  avg_10s;      /**< 10 second load average, in permille */
+	uint32_t  avg_60s;      /**< 60 second load average, in permille */
+};
+#endif /* CONFIG_SCHED_CPU_LOAD */
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
@@ -114,6 +114,11 @@ struct _thread_base {
 	/* CPU index on which thread was last run */
 	uint8_t cpu;
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* CPU index whose run queue holds the thread while queued */
+	uint8_t runq_cpu;
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 	/* Recursive count of irq_lock() calls */
 	uint8_t global_lock_count;
 
@@ -145,6 +150,11 @@ struct _thread_base {
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	struct k_cycle_stats  usage;   /* Track thread usage statistics */
 #endif /* CONFIG_SCHED_THREAD_USAGE */
+
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+	/* Cycle count when the thread became ready, 0 while not waiting */
+	uint32_t ready0;
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
 };
 
 typedef struct _thread_base _thread_base_t;
@@ -237,6 +247,33 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/*
+	 * This field is always zero for individual threads. It only comes
+	 * into play when gathering statistics for the CPU.
+	 */
+
+	struct k_ipi_stats ipi;
+#endif /* CONFIG_SCHED_IPI_STATS */
+
+#ifdef CONFIG_SCHED_CPU_LOAD
+	/*
+	 * This field is always zero for individual threads. For CPUs, their
+	 * load averages, and for all CPUs, the sum of these.
+	 */
+
+	struct k_cpu_load_stats load;
+#endif /* CONFIG_SCHED_CPU_LOAD */
+
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+	/*
+	 * For threads, the time spent ready but not running. For CPUs,
+	 * the same for all the threads switched in on the CPU.
+	 */
+
+	struct k_ready_latency_stats ready_latency;
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -115,12 +115,16 @@ struct _priq_rb {
 /* Traditional/textbook "multi-queue" structure.  Separate lists for a
  * small number (max 32 here) of fixed priorities.  This corresponds
  * to the original Zephyr scheduler.  RAM requirements are
- * comparatively high, but performance is very fast.  Won't work with
- * features like deadline scheduling which need large priority spaces
- * to represent their requirements.
+ * comparatively high, but performance is very fast.  With deadline
+ * scheduling each priority level becomes a red/black tree sorted by
+ * deadline instead, keeping the O(1) selection of the best level.
  */
 struct _priq_mq {
+#ifdef CONFIG_SCHED_DEADLINE
+	struct _priq_rb queues[K_NUM_THREAD_PRIO];
+#else
 	sys_dlist_t queues[K_NUM_THREAD_PRIO];
+#endif /* CONFIG_SCHED_DEADLINE */
 	unsigned long bitmask[PRIQ_BITMAP_SIZE];
 #ifndef CONFIG_SMP
 	unsigned int cached_queue_index;
@@ -157,7 +161,7 @@ struct _cpu {
 	/* one assigned idle thread per CPU */
 	struct k_thread *idle_thread;
 
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -192,6 +196,14 @@ struct _cpu {
 #endif
 #endif
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/* Scheduler IPI accounting, see k_ipi_stats_get() */
+	atomic_t ipi_sent;
+	uint32_t ipi_useful;
+	uint32_t ipi_spurious;
+	bool ipi_pending;
+#endif
+
 #ifdef CONFIG_OBJ_CORE_SYSTEM
 	struct k_obj_core  obj_core;
 #endif
@@ -213,7 +225,7 @@ struct z_kernel {
 	 * ready queue: can be big, keep after small fields, since some
 	 * assembly (e.g. ARC) are limited in the encoding of the offset
 	 */
-#ifndef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if !defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) && !defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	struct _ready_q ready_q;
 #endif
 
@@ -312,7 +324,9 @@ struct _timeout {
 	sys_dnode_t node;
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
-	/* Can't use k_ticks_t for header dependency reasons */
+	/* Can't use k_ticks_t for header dependency reasons.
+	 * Absolute expiry tick with CONFIG_TIMEOUT_WHEEL.
+	 */
 	int64_t dticks;
 #else
 	int32_t dticks;
@@ -214,6 +214,12 @@ enum ethernet_hw_caps {
 
 	/** 5 Gbits link supported */
 	ETHERNET_LINK_5000BASE_T	= BIT(22),
+
+	/** TCP segmentation offload. The driver splits TCP packets with a
+	 * non-zero net_pkt_gso_size() into segments of that payload size and
+	 * computes their IP and TCP checksums.
+	 */
+	ETHERNET_HW_TSO			= BIT(23),
 };
 
 /** @cond INTERNAL_HIDDEN */
@@ -292,6 +292,13 @@ struct net_pkt {
 	/** IPv4/IPv6 Explicit Congestion Notification value. */
 	uint8_t ip_ecn : 2;
 #endif /* CONFIG_NET_IP_DSCP_ECN */
+
+#if defined(CONFIG_NET_TCP_GSO)
+	/* Payload size of the segments this TCP packet is to be split
+	 * into before transmission, 0 if it is not a super-segment.
+	 */
+	uint16_t gso_size;
+#endif /* CONFIG_NET_TCP_GSO */
 #endif /* CONFIG_NET_IP */
 
 #if defined(CONFIG_NET_VLAN)
@@ -516,6 +523,27 @@ static inline void net_pkt_set_chksum_done(struct net_pkt *pkt,
 	pkt->chksum_done = is_chksum_done;
 }
 
+static inline uint16_t net_pkt_gso_size(struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_TCP_GSO)
+	return pkt->gso_size;
+#else
+	ARG_UNUSED(pkt);
+
+	return 0;
+#endif
+}
+
+static inline void net_pkt_set_gso_size(struct net_pkt *pkt, uint16_t size)
+{
+#if defined(CONFIG_NET_TCP_GSO)
+	pkt->gso_size = size;
+#else
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(size);
+#endif
+}
+
 static inline uint8_t net_pkt_ip_hdr_len(struct net_pkt *pkt)
 {
 #if defined(CONFIG_NET_IP)
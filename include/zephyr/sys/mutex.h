@@ -11,9 +11,9 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * With CONFIG_SYS_MUTEX_FUTEX, uncontended sys_mutexes are locked and
+ * unlocked with simple atomic ops instead of syscalls, similar to Linux's
+ * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI.
  */
 
 #ifdef __cplusplus
@@ -21,18 +21,30 @@ extern "C" {
 #endif
 
 #ifdef CONFIG_USERSPACE
+#include <errno.h>
 #include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+#include <zephyr/kernel.h>
+#endif
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FUTEX, the owner thread ID, or zero when
+	 * unlocked, ORed with Z_SYS_MUTEX_WAITERS once the kernel tracks the
+	 * mutex. Unused otherwise.
 	 */
 	atomic_t val;
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	/* Recursive lock count, only ever accessed by the owner */
+	uint32_t lock_count;
+#endif
 };
 
+/* Threads are waiting for the mutex: the owner must unlock it in the kernel */
+#define Z_SYS_MUTEX_WAITERS ((atomic_val_t)BIT(0))
+
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
  * @ingroup kernel_apis
@@ -67,10 +79,16 @@ struct sys_mutex {
  */
 static inline void sys_mutex_init(struct sys_mutex *mutex)
 {
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	/* Start unlocked, whatever the memory held before */
+	atomic_set(&mutex->val, 0);
+	mutex->lock_count = 0U;
+#else
 	ARG_UNUSED(mutex);
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 
-	/* Nothing to do, kernel-side data structures are initialized at
-	 * boot
+	/* Nothing else to do, kernel-side data structures are initialized
+	 * at boot
 	 */
 }
 
@@ -101,8 +119,35 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	int ret;
+
+	if (likely(atomic_cas(&mutex->val, 0, self))) {
+		mutex->lock_count = 1U;
+		return 0;
+	}
+
+	if ((atomic_get(&mutex->val) & ~Z_SYS_MUTEX_WAITERS) == self) {
+		mutex->lock_count++;
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -EBUSY;
+	}
+
+	/* Contended: wait in the kernel, which hands the mutex over */
+	ret = z_sys_mutex_kernel_lock(mutex, timeout);
+	if (ret == 0) {
+		mutex->lock_count = 1U;
+	}
+
+	return ret;
+#else
+	/* Without the futex fast path, make the syscall unconditionally */
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 }
 
 /**
@@ -124,8 +169,31 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	atomic_val_t val = atomic_get(&mutex->val);
+
+	if ((val & ~Z_SYS_MUTEX_WAITERS) != self) {
+		return (val == 0) ? -EINVAL : -EPERM;
+	}
+
+	if (mutex->lock_count > 1U) {
+		mutex->lock_count--;
+		return 0;
+	}
+
+	mutex->lock_count = 0U;
+
+	if (likely(atomic_cas(&mutex->val, self, 0))) {
+		return 0;
+	}
+
+	/* Threads are waiting: the kernel picks the next owner */
+	return z_sys_mutex_kernel_unlock(mutex);
+#else
+	/* Without the futex fast path, make the syscall unconditionally */
 	return z_sys_mutex_kernel_unlock(mutex);
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 }
 
 #include <zephyr/syscalls/mutex.h>
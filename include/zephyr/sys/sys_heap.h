@@ -65,6 +65,12 @@ struct z_heap_stress_result {
 	uint32_t successful_allocs;
 	uint32_t total_frees;
 	uint64_t accumulated_in_use_bytes;
+	/* Bytes in use summed over failed allocations only */
+	uint64_t accumulated_failed_in_use_bytes;
+	uint64_t accumulated_alloc_cycles;
+	uint64_t accumulated_free_cycles;
+	uint32_t max_alloc_cycles;
+	uint32_t max_free_cycles;
 };
 
 /**
@@ -229,7 +235,10 @@ static inline bool sys_heap_validate(struct sys_heap *heap)
  * target_percent full.  Allocation and free operations are provided
  * by the caller as callbacks (i.e. this can in theory test any heap).
  * Results, including counts of frees and successful/unsuccessful
- * allocations, are returned via the @a result struct.
+ * allocations, are returned via the @a result struct.  The struct also
+ * reports how full the heap was, on average, whenever an allocation
+ * failed (a measure of fragmentation), and the average and worst case
+ * cycle counts of the callbacks.
  *
  * @param alloc_fn Callback to perform an allocation.  Passes back the @a
  *              arg parameter as a context handle.
@@ -257,6 +266,24 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 		     int target_percent,
 		     struct z_heap_stress_result *result);
 
+/**
+ * Small object variant of sys_heap_stress().  Behaves the same, except
+ * that every allocation request is folded into the 1 to @a
+ * max_alloc_bytes range, which models workloads dominated by small
+ * fixed-size objects.
+ *
+ * @param max_alloc_bytes Largest allocation size requested (non-zero)
+ *
+ * See sys_heap_stress() for the other parameters.
+ */
+void sys_heap_stress_small(void *(*alloc_fn)(void *arg, size_t bytes),
+			   void (*free_fn)(void *arg, void *p),
+			   void *arg, size_t total_bytes,
+			   uint32_t op_count,
+			   void *scratch_mem, size_t scratch_bytes,
+			   int target_percent, size_t max_alloc_bytes,
+			   struct z_heap_stress_result *result);
+
 /** @brief Print heap internal structure information to the console
  *
  * Print information on the heap structure such as its size, chunk buckets,
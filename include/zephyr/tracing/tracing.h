@@ -1633,6 +1633,38 @@
  */
 #define sys_port_trace_k_pipe_read_exit(pipe, ret)
 
+/**
+ * @brief Trace Pipe vectored write attempt entry
+ * @param pipe Pipe object
+ * @param iov Array of buffers
+ * @param iovcnt Number of buffers
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_writev_enter(pipe, iov, iovcnt, timeout)
+
+/**
+ * @brief Trace Pipe vectored write attempt outcome
+ * @param pipe Pipe object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_writev_exit(pipe, ret)
+
+/**
+ * @brief Trace Pipe vectored read attempt entry
+ * @param pipe Pipe object
+ * @param iov Array of buffers
+ * @param iovcnt Number of buffers
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_pipe_readv_enter(pipe, iov, iovcnt, timeout)
+
+/**
+ * @brief Trace Pipe vectored read attempt outcome
+ * @param pipe Pipe object
+ * @param ret Return value
+ */
+#define sys_port_trace_k_pipe_readv_exit(pipe, ret)
+
 /**
  * @brief Trace Pipe cleanup entry
  * @param pipe Pipe object
@@ -123,6 +123,8 @@ static int event_walk_op(struct k_thread *thread, void *data)
 		thread->next_event_link = event_data->head;
 		event_data->head = thread;
 		z_abort_timeout(&thread->base.timeout);
+		arch_thread_return_value_set(thread, 0);
+		thread->events = event_data->events;
 	}
 
 	return 0;
@@ -132,7 +134,6 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
 {
 	k_spinlock_key_t  key;
-	struct k_thread  *thread;
 	struct event_walk_data data;
 	uint32_t previous_events;
 
@@ -155,20 +156,14 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * 1. Walk the waitq and create a linked list of threads to unpend.
 	 * 2. Unpend each of the threads in the linked list
 	 * 3. Ready each of the threads in the linked list
+	 *
+	 * Steps 2 and 3 are done as a single scheduler batch.
 	 */
 
 	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
 
 	if (data.head != NULL) {
-		thread = data.head;
-		struct k_thread *next;
-		do {
-			arch_thread_return_value_set(thread, 0);
-			thread->events = events;
-			next = thread->next_event_link;
-			z_sched_wake_thread(thread, false);
-			thread = next;
-		} while (thread != NULL);
+		(void)z_sched_wake_event_list(data.head);
 	}
 
 	z_reschedule(&event->lock, key);
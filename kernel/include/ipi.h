@@ -22,6 +22,9 @@
 void flag_ipi(uint32_t ipi_mask);
 void signal_pending_ipi(void);
 atomic_val_t ipi_mask_create(struct k_thread *thread);
+#ifdef CONFIG_SCHED_IPI_STATS
+void z_sched_ipi_stats_update(bool switched);
+#endif /* CONFIG_SCHED_IPI_STATS */
 #else
 #define flag_ipi(ipi_mask) do { } while (false)
 #define signal_pending_ipi() do { } while (false)
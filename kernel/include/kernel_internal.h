@@ -181,6 +181,15 @@ void z_mem_domain_exit_thread(struct k_thread *thread);
  * not recommended.
  */
 extern struct k_spinlock z_mem_domain_lock;
+
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+/* Contended sys_mutex paths, see kernel/mutex.c. @a val is the sys_mutex
+ * word in user memory and @a mutex the kernel-side k_mutex backing it.
+ */
+int z_mutex_futex_lock(struct k_mutex *mutex, atomic_t *val,
+		       k_timeout_t timeout);
+int z_mutex_futex_unlock(struct k_mutex *mutex, atomic_t *val);
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_GDBSTUB
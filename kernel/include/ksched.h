@@ -13,6 +13,7 @@
 #include <kthread.h>
 #include <zephyr/tracing/tracing.h>
 #include <stdbool.h>
+#include <limits.h>
 #include <priority_q.h>
 
 BUILD_ASSERT(K_LOWEST_APPLICATION_THREAD_PRIO
@@ -225,6 +226,41 @@ static ALWAYS_INLINE struct k_thread *z_unpend_first_thread(_wait_q_t *wait_q)
  */
 bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data);
 
+/**
+ * Wake up several threads pending on the provided wait queue
+ *
+ * Equivalent to calling z_sched_wake() up to @a count times, but
+ * _sched_spinlock is taken only once, the scheduler cache is recomputed
+ * once and the IPIs needed by all the woken threads are flagged together,
+ * so at most one IPI is sent per affected CPU on the next reschedule.
+ * Threads are woken in priority order.
+ *
+ * The same synchronization requirements as z_sched_wake() apply.
+ *
+ * @param wait_q Wait queue to wake up threads from
+ * @param count Maximum number of threads to wake up; UINT_MAX for all
+ * @param swap_retval Swap return value for the woken threads
+ * @param swap_data Data return value to supplement swap_retval. May be NULL.
+ * @return Number of threads woken up
+ */
+unsigned int z_sched_wake_many(_wait_q_t *wait_q, unsigned int count,
+			       int swap_retval, void *swap_data);
+
+#ifdef CONFIG_EVENTS
+/**
+ * Wake up a list of threads in a single scheduler pass
+ *
+ * Equivalent to calling z_sched_wake_thread(thread, false) on each thread
+ * of a list chained through next_event_link, with the batching properties
+ * of z_sched_wake_many(). The caller must have aborted the threads'
+ * timeouts already.
+ *
+ * @param head First thread of the list
+ * @return Number of threads woken up
+ */
+unsigned int z_sched_wake_event_list(struct k_thread *head);
+#endif /* CONFIG_EVENTS */
+
 /**
  * Wakes the specified thread.
  *
@@ -240,8 +276,8 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 /**
  * Wake up all threads pending on the provided wait queue
  *
- * Convenience function to invoke z_sched_wake() on all threads in the queue
- * until there are no more to wake up.
+ * Convenience function to invoke z_sched_wake_many() on all threads in the
+ * queue.
  *
  * @param wait_q Wait queue to wake up the highest prio thread
  * @param swap_retval Swap return value for woken thread
@@ -252,14 +288,8 @@ void z_sched_wake_thread(struct k_thread *thread, bool is_timeout);
 static inline bool z_sched_wake_all(_wait_q_t *wait_q, int swap_retval,
 				    void *swap_data)
 {
-	bool woken = false;
-
-	while (z_sched_wake(wait_q, swap_retval, swap_data)) {
-		woken = true;
-	}
-
 	/* True if we woke at least one thread up */
-	return woken;
+	return z_sched_wake_many(wait_q, UINT_MAX, swap_retval, swap_data) != 0U;
 }
 
 /**
@@ -327,6 +357,15 @@ void z_sched_usage_stop(void);
 
 void z_sched_usage_start(struct k_thread *thread);
 
+/**
+ * @brief Start measuring the ready-to-run latency of a thread
+ *
+ * Called when @a thread becomes ready, or is preempted while still
+ * ready. The latency is recorded when it is next switched in by
+ * z_sched_usage_start().
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+
 /**
  * @brief Retrieves CPU cycle usage data for specified core
  */
@@ -342,6 +381,12 @@ static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
 #ifdef CONFIG_SCHED_THREAD_USAGE
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+	if ((thread != _current) && z_is_thread_ready(_current)) {
+		/* Preempted: ready again, but no longer running */
+		z_sched_usage_ready(_current);
+	}
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
 	z_sched_usage_stop();
 	z_sched_usage_start(thread);
 #endif /* CONFIG_SCHED_THREAD_USAGE */
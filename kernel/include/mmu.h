@@ -328,10 +328,26 @@ void k_mem_page_frames_dump(void);
  * @brief Reserve space at the end of virtual memory.
  */
 #ifdef CONFIG_DEMAND_PAGING
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/* Number of data pages read ahead in one batch, into the scratch area */
+#define K_MEM_READ_AHEAD_PAGES	CONFIG_DEMAND_PAGING_READ_AHEAD_PAGES
+#else
+#define K_MEM_READ_AHEAD_PAGES	0
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 /* We reserve a virtual page as a scratch area for page-ins/outs at the end
- * of the address space
+ * of the address space, right after the pages for read-ahead batches if any
+ */
+#define K_MEM_VM_RESERVED	((K_MEM_READ_AHEAD_PAGES + 1) * CONFIG_MMU_PAGE_SIZE)
+
+/**
+ * @brief Location of the scratch area used for batched page-ins.
+ *
+ * Holds K_MEM_READ_AHEAD_PAGES pages, with K_MEM_SCRATCH_PAGE right after.
  */
-#define K_MEM_VM_RESERVED	CONFIG_MMU_PAGE_SIZE
+#define K_MEM_SCRATCH_AREA	((void *)((uintptr_t)CONFIG_KERNEL_VM_BASE + \
+					  (uintptr_t)CONFIG_KERNEL_VM_SIZE - \
+					  K_MEM_VM_RESERVED))
 
 /**
  * @brief Location of the scratch page used for demand paging.
@@ -406,6 +422,23 @@ int k_mem_page_frame_evict(uintptr_t phys);
  */
 bool k_mem_page_fault(void *addr);
 
+#ifdef CONFIG_DEMAND_PAGING_STATS
+/**
+ * Account for page frames examined to select one to evict
+ *
+ * Called by eviction algorithms from k_mem_paging_eviction_select(), so
+ * the cost of the algorithm in use shows in the eviction statistics.
+ *
+ * @param count Number of page frames examined
+ */
+void k_mem_paging_stats_eviction_scanned(uint32_t count);
+#else
+static inline void k_mem_paging_stats_eviction_scanned(uint32_t count)
+{
+	ARG_UNUSED(count);
+}
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
 #endif /* CONFIG_DEMAND_PAGING */
 #endif /* CONFIG_MMU */
 #endif /* KERNEL_INCLUDE_MMU_H */
@@ -276,10 +276,78 @@ static ALWAYS_INLINE unsigned int z_priq_mq_best_queue_index(struct _priq_mq *pq
 	return K_NUM_THREAD_PRIO - 1;
 }
 
+/* Per-priority level operations of the multi-queue.  With deadline
+ * scheduling each level is a red/black tree ordered by deadline (and
+ * then insertion order), otherwise a plain FIFO list.
+ */
+#ifdef CONFIG_SCHED_DEADLINE
+static ALWAYS_INLINE void z_priq_mq_level_init(struct _priq_rb *level)
+{
+	z_priq_rb_init(level);
+}
+
+static ALWAYS_INLINE void z_priq_mq_level_add(struct _priq_rb *level,
+					      struct k_thread *thread)
+{
+	z_priq_rb_add(level, thread);
+}
+
+static ALWAYS_INLINE void z_priq_mq_level_remove(struct _priq_rb *level,
+						 struct k_thread *thread)
+{
+	z_priq_rb_remove(level, thread);
+}
+
+static ALWAYS_INLINE bool z_priq_mq_level_is_empty(struct _priq_rb *level)
+{
+	return level->tree.root == NULL;
+}
+
+static ALWAYS_INLINE struct k_thread *z_priq_mq_level_best(struct _priq_rb *level)
+{
+	return z_priq_rb_best(level);
+}
+#else
+static ALWAYS_INLINE void z_priq_mq_level_init(sys_dlist_t *level)
+{
+	sys_dlist_init(level);
+}
+
+static ALWAYS_INLINE void z_priq_mq_level_add(sys_dlist_t *level,
+					      struct k_thread *thread)
+{
+	sys_dlist_append(level, &thread->base.qnode_dlist);
+}
+
+static ALWAYS_INLINE void z_priq_mq_level_remove(sys_dlist_t *level,
+						 struct k_thread *thread)
+{
+	ARG_UNUSED(level);
+
+	sys_dlist_dequeue(&thread->base.qnode_dlist);
+}
+
+static ALWAYS_INLINE bool z_priq_mq_level_is_empty(sys_dlist_t *level)
+{
+	return sys_dlist_is_empty(level);
+}
+
+static ALWAYS_INLINE struct k_thread *z_priq_mq_level_best(sys_dlist_t *level)
+{
+	sys_dnode_t *n = sys_dlist_peek_head(level);
+
+	if (likely(n != NULL)) {
+		return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_SCHED_DEADLINE */
+
 static ALWAYS_INLINE void z_priq_mq_init(struct _priq_mq *q)
 {
 	for (int i = 0; i < ARRAY_SIZE(q->queues); i++) {
-		sys_dlist_init(&q->queues[i]);
+		z_priq_mq_level_init(&q->queues[i]);
 	}
 
 #ifndef CONFIG_SMP
@@ -292,7 +360,7 @@ static ALWAYS_INLINE void z_priq_mq_add(struct _priq_mq *pq,
 {
 	struct prio_info pos = get_prio_info(thread->base.prio);
 
-	sys_dlist_append(&pq->queues[pos.offset_prio], &thread->base.qnode_dlist);
+	z_priq_mq_level_add(&pq->queues[pos.offset_prio], thread);
 	pq->bitmask[pos.idx] |= BIT(pos.bit);
 
 #ifndef CONFIG_SMP
@@ -307,8 +375,8 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 {
 	struct prio_info pos = get_prio_info(thread->base.prio);
 
-	sys_dlist_dequeue(&thread->base.qnode_dlist);
-	if (unlikely(sys_dlist_is_empty(&pq->queues[pos.offset_prio]))) {
+	z_priq_mq_level_remove(&pq->queues[pos.offset_prio], thread);
+	if (unlikely(z_priq_mq_level_is_empty(&pq->queues[pos.offset_prio]))) {
 		pq->bitmask[pos.idx] &= ~BIT(pos.bit);
 #ifndef CONFIG_SMP
 		pq->cached_queue_index = z_priq_mq_best_queue_index(pq);
@@ -321,9 +389,8 @@ static ALWAYS_INLINE void z_priq_mq_yield(struct _priq_mq *pq)
 #ifndef CONFIG_SMP
 	struct prio_info pos = get_prio_info(_current->base.prio);
 
-	sys_dlist_dequeue(&_current->base.qnode_dlist);
-	sys_dlist_append(&pq->queues[pos.offset_prio],
-			 &_current->base.qnode_dlist);
+	z_priq_mq_level_remove(&pq->queues[pos.offset_prio], _current);
+	z_priq_mq_level_add(&pq->queues[pos.offset_prio], _current);
 #endif
 }
 
@@ -335,13 +402,7 @@ static ALWAYS_INLINE struct k_thread *z_priq_mq_best(struct _priq_mq *pq)
 	unsigned int index = pq->cached_queue_index;
 #endif
 
-	sys_dnode_t *n = sys_dlist_peek_head(&pq->queues[index]);
-
-	if (likely(n != NULL)) {
-		return CONTAINER_OF(n, struct k_thread, base.qnode_dlist);
-	}
-
-	return NULL;
+	return z_priq_mq_level_best(&pq->queues[index]);
 }
 
 #endif /* ZEPHYR_KERNEL_INCLUDE_PRIORITY_Q_H_ */
@@ -32,6 +32,18 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 
 int z_abort_timeout(struct _timeout *to);
 
+/* Add a list of timeouts with one pass over the timeout queue.  Each
+ * timeout is linked into @p batch through its node, has its fn set and
+ * holds the ticks of its k_timeout_t in dticks.  K_FOREVER timeouts
+ * must be left out.  The list is empty on return.
+ */
+void z_add_timeouts(sys_dlist_t *batch);
+
+/* Abort the timeouts found at @p offset in each of @p count objects,
+ * taking the timeout lock once.  Inactive timeouts are skipped.
+ */
+void z_abort_timeouts(void *const *objs, size_t count, size_t offset);
+
 static inline bool z_is_inactive_timeout(const struct _timeout *to)
 {
 	return !sys_dnode_is_linked(&to->node);
@@ -66,6 +66,55 @@ atomic_val_t ipi_mask_create(struct k_thread *thread)
 	return (atomic_val_t)ipi_mask;
 }
 
+#ifdef CONFIG_SCHED_IPI_STATS
+static void ipi_stats_sent(uint32_t cpu_bitmap)
+{
+	uint32_t  num_cpus = (uint32_t)arch_num_cpus();
+	uint32_t  id = _current_cpu->id;
+
+#ifndef CONFIG_ARCH_HAS_DIRECTED_IPIS
+	/* A broadcast interrupts every other CPU, whatever the mask */
+	cpu_bitmap = IPI_ALL_CPUS_MASK;
+#endif /* !CONFIG_ARCH_HAS_DIRECTED_IPIS */
+
+	for (uint32_t i = 0; i < num_cpus; i++) {
+		if ((i != id) && ((cpu_bitmap & BIT(i)) != 0U)) {
+			atomic_inc(&_kernel.cpus[i].ipi_sent);
+		}
+	}
+}
+
+/* Called with _sched_spinlock held on the first scheduling decision
+ * after z_sched_ipi(), to classify the IPI that triggered it.
+ */
+void z_sched_ipi_stats_update(bool switched)
+{
+	struct _cpu *cpu = _current_cpu;
+
+	if (cpu->ipi_pending) {
+		cpu->ipi_pending = false;
+		if (switched) {
+			cpu->ipi_useful++;
+		} else {
+			cpu->ipi_spurious++;
+		}
+	}
+}
+
+int k_ipi_stats_get(int cpu, struct k_ipi_stats *stats)
+{
+	if ((stats == NULL) || (cpu < 0) || (cpu >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	stats->sent = (uint32_t)atomic_get(&_kernel.cpus[cpu].ipi_sent);
+	stats->useful = _kernel.cpus[cpu].ipi_useful;
+	stats->spurious = _kernel.cpus[cpu].ipi_spurious;
+
+	return 0;
+}
+#endif /* CONFIG_SCHED_IPI_STATS */
+
 void signal_pending_ipi(void)
 {
 	/* Synchronization note: you might think we need to lock these
@@ -81,6 +130,9 @@ void signal_pending_ipi(void)
 
 		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
 		if (cpu_bitmap != 0) {
+#ifdef CONFIG_SCHED_IPI_STATS
+			ipi_stats_sent(cpu_bitmap);
+#endif /* CONFIG_SCHED_IPI_STATS */
 #ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
 			arch_sched_directed_ipi(cpu_bitmap);
 #else
@@ -100,6 +152,10 @@ void z_sched_ipi(void)
 	z_trace_sched_ipi();
 #endif /* CONFIG_TRACE_SCHED_IPI */
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	_current_cpu->ipi_pending = true;
+#endif /* CONFIG_SCHED_IPI_STATS */
+
 #ifdef CONFIG_TIMESLICING
 	if (thread_is_sliceable(_current)) {
 		z_time_slice();
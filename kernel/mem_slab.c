@@ -33,6 +33,9 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	((struct k_mem_slab_info *)stats)->num_used = k_mem_slab_num_used_get(slab);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -48,9 +51,8 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -72,7 +74,7 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 	k_spin_unlock(&slab->lock, key);
@@ -179,6 +181,11 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->info.num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	atomic_clear(&slab->waiters);
+	memset(slab->cpu_cache, 0, sizeof(slab->cpu_cache));
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
@@ -218,8 +225,226 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+
+#define CACHE_SIZE  CONFIG_MEM_SLAB_CPU_CACHE_SIZE
+#define CACHE_BATCH (CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2)
+
+/*
+ * Each CPU keeps a small stack of free blocks per slab, protected by a
+ * per-CPU spinlock that is only ever contended by the slow paths below.
+ * info.num_used counts every block that is not on the slab's own free
+ * list, so blocks sitting in a cache are subtracted again when usage
+ * is reported.
+ *
+ * Lock ordering is cache lock, then slab lock.  Blocks leaving a cache
+ * for the slab are detached under the cache lock and handed back with
+ * only the slab lock held, so that pended allocators get woken.
+ *
+ * A thread that is about to pend bumps slab->waiters first and then
+ * reclaims every cache.  A freeing CPU re-checks waiters after pushing
+ * onto its cache and flushes the cache if it is non-zero, so a block
+ * can never get stranded in a cache while somebody waits for one.
+ * For the same reason a refill only takes the block it needs, instead
+ * of a whole batch, while waiters is non-zero.
+ */
+
+static struct k_mem_slab_cpu_cache *cache_lock(struct k_mem_slab *slab,
+					       k_spinlock_key_t *key)
+{
+	struct k_mem_slab_cpu_cache *cache;
+
+	/* Being moved to another CPU before the lock is taken only means
+	 * using the cache of the previous one, which its lock keeps safe.
+	 */
+	cache = &slab->cpu_cache[arch_curr_cpu()->id];
+	*key = k_spin_lock(&cache->lock);
+
+	return cache;
+}
+
+static void cache_unlock(struct k_mem_slab_cpu_cache *cache,
+			 k_spinlock_key_t key)
+{
+	k_spin_unlock(&cache->lock, key);
+}
+
+/* Detach up to @a count blocks from @a cache, returning them as a list */
+static char *cache_detach(struct k_mem_slab_cpu_cache *cache, uint32_t count,
+			  uint32_t *detached)
+{
+	char *list = cache->free_list;
+	char *tail = NULL;
+	uint32_t n;
+
+	for (n = 0U; (n < count) && (cache->free_list != NULL); n++) {
+		tail = cache->free_list;
+		cache->free_list = *(char **)tail;
+	}
+
+	if (tail != NULL) {
+		*(char **)tail = NULL;
+	}
+
+	cache->count -= n;
+	*detached = n;
+
+	return (n == 0U) ? NULL : list;
+}
+
+/* Give a list of blocks back to the slab, waking pended allocators */
+static void slab_release(struct k_mem_slab *slab, char *list, uint32_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	bool resched = false;
+
+	while (list != NULL) {
+		char *block = list;
+		struct k_thread *pending_thread = NULL;
+
+		list = *(char **)block;
+
+		if ((slab->free_list == NULL) && IS_ENABLED(CONFIG_MULTITHREADING)) {
+			pending_thread = z_unpend_first_thread(&slab->wait_q);
+		}
+
+		if (pending_thread != NULL) {
+			/* Block stays accounted as used by its new owner */
+			z_thread_return_value_set_with_data(pending_thread, 0, block);
+			z_ready_thread(pending_thread);
+			resched = true;
+			count--;
+		} else {
+			*(char **)block = slab->free_list;
+			slab->free_list = block;
+		}
+	}
+
+	slab->info.num_used -= count;
+
+	if (resched) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+/* Pull the free blocks out of every CPU cache back into the slab */
+static void cache_reclaim_all(struct k_mem_slab *slab)
+{
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct k_mem_slab_cpu_cache *cache = &slab->cpu_cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+		uint32_t count;
+		char *list = cache_detach(cache, cache->count, &count);
+
+		k_spin_unlock(&cache->lock, key);
+
+		if (list != NULL) {
+			slab_release(slab, list, count);
+		}
+	}
+}
+
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	k_spinlock_key_t key;
+	struct k_mem_slab_cpu_cache *cache = cache_lock(slab, &key);
+	char *block = cache->free_list;
+
+	if (block == NULL) {
+		k_spinlock_key_t slab_key = k_spin_lock(&slab->lock);
+		uint32_t batch = CACHE_BATCH;
+
+		/* Refill with a batch of blocks in one go, unless other
+		 * threads wait for blocks: then only take the one needed,
+		 * the rest must stay in the slab for them.
+		 */
+		if (atomic_get(&slab->waiters) != 0) {
+			batch = 1U;
+		}
+
+		while ((cache->count < batch) && (slab->free_list != NULL)) {
+			block = slab->free_list;
+			slab->free_list = *(char **)block;
+			*(char **)block = cache->free_list;
+			cache->free_list = block;
+			cache->count++;
+			slab->info.num_used++;
+		}
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+		slab->info.max_used = MAX(k_mem_slab_num_used_get(slab) + 1U,
+					  slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+		k_spin_unlock(&slab->lock, slab_key);
+		block = cache->free_list;
+	}
+
+	if (block != NULL) {
+		__ASSERT(slab_ptr_is_good(slab, block), "slab corruption detected");
+		cache->free_list = *(char **)block;
+		cache->count--;
+		*mem = block;
+	}
+
+	cache_unlock(cache, key);
+
+	return block != NULL;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	k_spinlock_key_t key;
+	struct k_mem_slab_cpu_cache *cache;
+	char *list = NULL;
+	uint32_t count = 0U;
+
+	if (atomic_get(&slab->waiters) != 0) {
+		/* Someone is waiting: hand the block over directly */
+		return false;
+	}
+
+	cache = cache_lock(slab, &key);
+
+	*(char **)mem = cache->free_list;
+	cache->free_list = mem;
+	cache->count++;
+
+	if (atomic_get(&slab->waiters) != 0) {
+		list = cache_detach(cache, cache->count, &count);
+	} else if (cache->count > CACHE_SIZE) {
+		list = cache_detach(cache, CACHE_BATCH, &count);
+	}
+
+	cache_unlock(cache, key);
+
+	if (list != NULL) {
+		slab_release(slab, list, count);
+	}
+
+	return true;
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+
+	/* The slab ran dry: announce the intent to wait before collecting
+	 * whatever the other CPUs still cache, see cache_free().
+	 */
+	atomic_inc(&slab->waiters);
+	cache_reclaim_all(slab);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
@@ -255,11 +480,19 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		atomic_dec(&slab->waiters);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
 	}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	atomic_dec(&slab->waiters);
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 	k_spin_unlock(&slab->lock, key);
@@ -275,6 +508,15 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
@@ -307,9 +549,8 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			    slab->info.block_size;
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
 				     slab->info.block_size;
@@ -331,7 +572,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
@@ -384,7 +384,15 @@ static void *virt_region_alloc(size_t size, size_t align)
  * This implies in the future there may be multiple slists managing physical
  * pages. Each page frame will still just have one snode link.
  */
+#ifdef CONFIG_MMU_CONTIG_ALLOC
+/* With contiguous allocations the free page frames are tracked instead with
+ * one bit per entry in k_mem_page_frames[], set if the page frame is not free,
+ * so runs of physically contiguous free page frames can be found.
+ */
+SYS_BITARRAY_DEFINE_STATIC(free_page_frame_bitmap, K_MEM_NUM_PAGE_FRAMES);
+#else
 static sys_sflist_t free_page_frame_list;
+#endif /* CONFIG_MMU_CONTIG_ALLOC */
 
 /* Number of unused and available free page frames.
  * This information may go stale immediately.
@@ -398,13 +406,24 @@ static size_t z_free_page_count;
 /* Get an unused page frame. don't care which one, or NULL if there are none */
 static struct k_mem_page_frame *free_page_frame_list_get(void)
 {
-	sys_sfnode_t *node;
 	struct k_mem_page_frame *pf = NULL;
+#ifdef CONFIG_MMU_CONTIG_ALLOC
+	size_t offset;
+
+	if (sys_bitarray_alloc(&free_page_frame_bitmap, 1, &offset) == 0) {
+		pf = &k_mem_page_frames[offset];
+	}
+#else
+	sys_sfnode_t *node;
 
 	node = sys_sflist_get(&free_page_frame_list);
 	if (node != NULL) {
-		z_free_page_count--;
 		pf = CONTAINER_OF(node, struct k_mem_page_frame, node);
+	}
+#endif /* CONFIG_MMU_CONTIG_ALLOC */
+
+	if (pf != NULL) {
+		z_free_page_count--;
 		PF_ASSERT(pf, k_mem_page_frame_is_free(pf),
 			 "on free list but not free");
 		pf->va_and_flags = 0;
@@ -420,14 +439,78 @@ static void free_page_frame_list_put(struct k_mem_page_frame *pf)
 		 "unavailable page put on free list");
 
 	sys_sfnode_init(&pf->node, K_MEM_PAGE_FRAME_FREE);
+#ifdef CONFIG_MMU_CONTIG_ALLOC
+	(void)sys_bitarray_free(&free_page_frame_bitmap, 1,
+				pf - k_mem_page_frames);
+#else
 	sys_sflist_append(&free_page_frame_list, &pf->node);
+#endif /* CONFIG_MMU_CONTIG_ALLOC */
 	z_free_page_count++;
 }
 
 static void free_page_frame_list_init(void)
 {
+#ifdef CONFIG_MMU_CONTIG_ALLOC
+	/* No page frame is free until put on the list */
+	(void)sys_bitarray_set_region(&free_page_frame_bitmap,
+				      K_MEM_NUM_PAGE_FRAMES, 0);
+#else
 	sys_sflist_init(&free_page_frame_list);
+#endif /* CONFIG_MMU_CONTIG_ALLOC */
+}
+
+#ifdef CONFIG_MMU_CONTIG_ALLOC
+/* Get a run of count physically contiguous free page frames, starting at a
+ * physical address aligned to align if such a run is available, or NULL if
+ * there is no run long enough at all.
+ */
+static struct k_mem_page_frame *free_page_frame_run_get(size_t count, size_t align)
+{
+	size_t align_frames = align / CONFIG_MMU_PAGE_SIZE;
+	struct k_mem_page_frame *pf;
+	size_t offset;
+	int ret = -ENOMEM;
+
+	if (align_frames > 1U) {
+		/* Over-allocate by up to one alignment, then give back
+		 * the frames before and after the aligned run.
+		 */
+		ret = sys_bitarray_alloc(&free_page_frame_bitmap,
+					 count + align_frames - 1U, &offset);
+		if (ret == 0) {
+			uintptr_t phys = k_mem_page_frame_to_phys(&k_mem_page_frames[offset]);
+			size_t lead = (ROUND_UP(phys, align) - phys) / CONFIG_MMU_PAGE_SIZE;
+			size_t trail = align_frames - 1U - lead;
+
+			if (lead > 0U) {
+				(void)sys_bitarray_free(&free_page_frame_bitmap,
+							lead, offset);
+			}
+			if (trail > 0U) {
+				(void)sys_bitarray_free(&free_page_frame_bitmap,
+							trail, offset + lead + count);
+			}
+			offset += lead;
+		}
+	}
+
+	if (ret != 0) {
+		ret = sys_bitarray_alloc(&free_page_frame_bitmap, count, &offset);
+		if (ret != 0) {
+			return NULL;
+		}
+	}
+
+	z_free_page_count -= count;
+	for (pf = &k_mem_page_frames[offset]; pf < &k_mem_page_frames[offset + count]; pf++) {
+		PF_ASSERT(pf, k_mem_page_frame_is_free(pf),
+			  "on free list but not free");
+		pf->va_and_flags = 0;
+	}
+
+	return &k_mem_page_frames[offset];
 }
+#endif /* CONFIG_MMU_CONTIG_ALLOC */
 
 static void page_frame_free_locked(struct k_mem_page_frame *pf)
 {
@@ -566,6 +649,64 @@ static int map_anon_page(void *addr, uint32_t flags)
 	return 0;
 }
 
+#ifdef CONFIG_MMU_CONTIG_ALLOC
+/* Allocate a run of free page frames and map them, along with unmapped guard
+ * pages before and after, in one go.
+ *
+ * The run and the virtual region are aligned as the arch would like for a
+ * region of this size, so it may use larger pages to map it. The page frames
+ * are always pinned: evicting them would break up the run.
+ */
+static uint8_t *map_anon_contig(size_t size, uint32_t flags)
+{
+	size_t count = size / CONFIG_MMU_PAGE_SIZE;
+	struct k_mem_page_frame *pf;
+	uintptr_t phys;
+	size_t align;
+	uint8_t *base;
+	uint8_t *dst;
+	uint8_t *pos;
+
+	pf = free_page_frame_run_get(count, arch_virt_region_align(0, size));
+	if (pf == NULL) {
+		LOG_ERR("no run of %zu free page frames", count);
+		return NULL;
+	}
+	phys = k_mem_page_frame_to_phys(pf);
+
+	/* Leave room for the guard pages while keeping the alignment */
+	align = arch_virt_region_align(phys, size);
+	base = virt_region_alloc(size + (align * 2), align);
+	if (base == NULL) {
+		for (size_t i = 0; i < count; i++) {
+			page_frame_free_locked(&pf[i]);
+		}
+		return NULL;
+	}
+	dst = base + align;
+	if (align > CONFIG_MMU_PAGE_SIZE) {
+		virt_region_free(base, align - CONFIG_MMU_PAGE_SIZE);
+		virt_region_free(dst + size + CONFIG_MMU_PAGE_SIZE,
+				 align - CONFIG_MMU_PAGE_SIZE);
+	}
+
+	arch_mem_unmap(dst - CONFIG_MMU_PAGE_SIZE, CONFIG_MMU_PAGE_SIZE);
+	arch_mem_unmap(dst + size, CONFIG_MMU_PAGE_SIZE);
+	arch_mem_map(dst, phys, size, flags);
+
+	VIRT_FOREACH(dst, size, pos) {
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_PINNED);
+		frame_mapped_set(pf, pos);
+		pf++;
+	}
+
+	LOG_DBG("memory mapping anon pages %p to %p -> 0x%lx contiguous",
+		dst, pos - 1, phys);
+
+	return dst;
+}
+#endif /* CONFIG_MMU_CONTIG_ALLOC */
+
 void *k_mem_map_phys_guard(uintptr_t phys, size_t size, uint32_t flags, bool is_anon)
 {
 	uint8_t *dst;
@@ -593,6 +734,12 @@ void *k_mem_map_phys_guard(uintptr_t phys, size_t size, uint32_t flags, bool is_
 		LOG_ERR("zero sized memory mapping");
 		return NULL;
 	}
+	if (((flags & K_MEM_MAP_CONTIG) != 0U) &&
+	    (!IS_ENABLED(CONFIG_MMU_CONTIG_ALLOC) || !is_anon ||
+	     ((flags & K_MEM_MAP_UNPAGED) != 0U))) {
+		LOG_ERR("contiguous mapping not supported");
+		return NULL;
+	}
 
 	/* Need extra for the guard pages (before and after) which we
 	 * won't map.
@@ -604,6 +751,13 @@ void *k_mem_map_phys_guard(uintptr_t phys, size_t size, uint32_t flags, bool is_
 
 	key = k_spin_lock(&z_mm_lock);
 
+#ifdef CONFIG_MMU_CONTIG_ALLOC
+	if ((flags & K_MEM_MAP_CONTIG) != 0U) {
+		dst = map_anon_contig(size, flags | K_MEM_CACHE_WB);
+		goto out;
+	}
+#endif /* CONFIG_MMU_CONTIG_ALLOC */
+
 	dst = virt_region_alloc(total_size, CONFIG_MMU_PAGE_SIZE);
 	if (dst == NULL) {
 		/* Address space has no free region */
@@ -717,7 +871,10 @@ void k_mem_unmap_phys_guard(void *addr, size_t size, bool is_anon)
 	}
 
 	if (is_anon) {
-		/* Unmapping anonymous memory */
+		/* Unmapping anonymous memory. Page frames and backing store
+		 * locations are released page by page, but the mappings are
+		 * all removed at the end so the TLB is only flushed once.
+		 */
 		VIRT_FOREACH(addr, size, pos) {
 #ifdef CONFIG_DEMAND_PAGING
 			enum arch_page_location status;
@@ -731,7 +888,6 @@ void k_mem_unmap_phys_guard(void *addr, size_t size, bool is_anon)
 				 * Simply get rid of the MMU entry and free
 				 * corresponding backing store.
 				 */
-				arch_mem_unmap(pos, CONFIG_MMU_PAGE_SIZE);
 				k_mem_paging_backing_store_location_free(location);
 				continue;
 			case ARCH_PAGE_LOCATION_PAGED_IN:
@@ -757,7 +913,7 @@ void k_mem_unmap_phys_guard(void *addr, size_t size, bool is_anon)
 				 __func__, pos);
 			if (ret != 0) {
 				/* Found an address not mapped. Do not continue. */
-				goto out;
+				break;
 			}
 
 			__ASSERT(k_mem_is_page_frame(phys),
@@ -767,7 +923,7 @@ void k_mem_unmap_phys_guard(void *addr, size_t size, bool is_anon)
 				 * description in the page frame array.
 				 * This should not happen. Do not continue.
 				 */
-				goto out;
+				break;
 			}
 
 			/* Grab the corresponding page frame from physical address */
@@ -779,10 +935,9 @@ void k_mem_unmap_phys_guard(void *addr, size_t size, bool is_anon)
 				/* Page frame is not marked mapped.
 				 * This should not happen. Do not continue.
 				 */
-				goto out;
+				break;
 			}
 
-			arch_mem_unmap(pos, CONFIG_MMU_PAGE_SIZE);
 #ifdef CONFIG_DEMAND_PAGING
 			if (IS_ENABLED(CONFIG_EVICTION_TRACKING) &&
 			    (!k_mem_page_frame_is_pinned(pf))) {
@@ -793,6 +948,14 @@ void k_mem_unmap_phys_guard(void *addr, size_t size, bool is_anon)
 			/* Put the page frame back into free list */
 			page_frame_free_locked(pf);
 		}
+
+		if (pos != addr) {
+			arch_mem_unmap(addr, pos - (uint8_t *)addr);
+		}
+		if (pos != ((uint8_t *)addr + size)) {
+			/* Stopped at an address that was not mapped */
+			goto out;
+		}
 	} else {
 		/*
 		 * Unmapping previous mapped memory with specific physical address.
@@ -1244,6 +1407,40 @@ static inline void do_backing_store_page_in(uintptr_t location)
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+static inline void do_backing_store_page_in_batch(const uintptr_t *locations,
+						  size_t count)
+{
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+	uint32_t time_diff;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+
+	time_start = timing_counter_get();
+#else
+	uint32_t time_start;
+
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	k_mem_paging_backing_store_page_in_batch(locations, count);
+
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_end = timing_counter_get();
+	time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
+#else
+	time_diff = k_cycle_get_32() - time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+
+	z_paging_histogram_inc(&z_paging_histogram_backing_store_page_in,
+			       time_diff);
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static inline void do_backing_store_page_out(uintptr_t location)
 {
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
@@ -1555,8 +1752,18 @@ static inline void paging_stats_faults_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+#ifdef CONFIG_DEMAND_PAGING_STATS
+/* Page frames examined by the eviction algorithm during one selection */
+static uint32_t eviction_scanned;
+
+void k_mem_paging_stats_eviction_scanned(uint32_t count)
+{
+	eviction_scanned += count;
+}
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
 static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
-					     bool dirty)
+					     bool dirty, uint32_t cycles)
 {
 #ifdef CONFIG_DEMAND_PAGING_STATS
 	if (dirty) {
@@ -1564,23 +1771,34 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 	} else {
 		paging_stats.eviction.clean++;
 	}
+	paging_stats.eviction.scanned += eviction_scanned;
+	paging_stats.eviction.select_cycles += cycles;
+	paging_stats.eviction.select_cycles_max =
+		MAX(paging_stats.eviction.select_cycles_max, cycles);
 #ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
 	if (dirty) {
 		faulting_thread->paging_stats.eviction.dirty++;
 	} else {
 		faulting_thread->paging_stats.eviction.clean++;
 	}
+	faulting_thread->paging_stats.eviction.scanned += eviction_scanned;
+	faulting_thread->paging_stats.eviction.select_cycles += cycles;
+	faulting_thread->paging_stats.eviction.select_cycles_max =
+		MAX(faulting_thread->paging_stats.eviction.select_cycles_max, cycles);
 #else
 	ARG_UNUSED(faulting_thread);
 #endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(cycles);
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
-static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
+static inline struct k_mem_page_frame *do_eviction_select(bool *dirty,
+							  uint32_t *cycles)
 {
 	struct k_mem_page_frame *pf;
 
-#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS
 	uint32_t time_diff;
 
 #ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
@@ -1592,11 +1810,13 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 
 	time_start = k_cycle_get_32();
 #endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
-#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
+	eviction_scanned = 0U;
+#endif /* CONFIG_DEMAND_PAGING_STATS */
 
 	pf = k_mem_paging_eviction_select(dirty);
 
-#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS
 #ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
 	time_end = timing_counter_get();
 	time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
@@ -1604,12 +1824,174 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	time_diff = k_cycle_get_32() - time_start;
 #endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
 
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
 	z_paging_histogram_inc(&z_paging_histogram_eviction, time_diff);
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 
+	*cycles = time_diff;
+#else
+	*cycles = 0U;
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
 	return pf;
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/* Page right after the last one paged in, where a page fault is sequential */
+static uint8_t *read_ahead_next;
+
+static inline void paging_stats_read_ahead_inc(struct k_thread *faulting_thread,
+					       size_t count)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.pagefaults.read_ahead += count;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.pagefaults.read_ahead += count;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(faulting_thread);
+	ARG_UNUSED(count);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+/* Page in the data pages following a sequential page fault at addr, in one
+ * backing store request. Called with z_mm_lock held, as *key.
+ *
+ * Read-ahead stops at the first page that isn't paged out to the backing
+ * store, or when no page frame can be prepared for it without taking the
+ * backing store locations reserved for page faults. The page frames are
+ * kept busy until paged in so they can't be picked for eviction in the
+ * meantime, and are mapped to K_MEM_SCRATCH_AREA for the backing store.
+ */
+static size_t page_in_read_ahead(uint8_t *addr, k_spinlock_key_t *key,
+				 struct k_thread *faulting_thread)
+{
+	struct k_mem_page_frame *pfs[K_MEM_READ_AHEAD_PAGES];
+	uintptr_t locations[K_MEM_READ_AHEAD_PAGES];
+	uintptr_t page_out_location;
+	enum arch_page_location status;
+	struct k_mem_page_frame *pf;
+	uint32_t select_cycles;
+	uint8_t *pos = addr;
+	size_t count = 0;
+	bool dirty;
+	int ret;
+
+	while (count < K_MEM_READ_AHEAD_PAGES) {
+		pos += CONFIG_MMU_PAGE_SIZE;
+		if (pos >= Z_VIRT_REGION_END_ADDR) {
+			break;
+		}
+
+		status = arch_page_location_get(pos, &locations[count]);
+		if (status != ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+#ifdef CONFIG_DEMAND_MAPPING
+		if (locations[count] == ARCH_UNPAGED_ANON_ZERO ||
+		    locations[count] == ARCH_UNPAGED_ANON_UNINIT) {
+			/* Nothing to read from the backing store */
+			break;
+		}
+#endif /* CONFIG_DEMAND_MAPPING */
+
+		dirty = false;
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			pf = do_eviction_select(&dirty, &select_cycles);
+			if (pf == NULL) {
+				break;
+			}
+			ret = page_frame_prepare_locked(pf, &dirty, false,
+							&page_out_location);
+			if (ret != 0) {
+				/* The page frame is left untouched */
+				break;
+			}
+			LOG_DBG("evicting %p at 0x%lx for read-ahead",
+				k_mem_page_frame_to_virt(pf),
+				k_mem_page_frame_to_phys(pf));
+
+			paging_stats_eviction_inc(faulting_thread, dirty,
+						  select_cycles);
+		}
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_BUSY);
+		pfs[count] = pf;
+		count++;
+
+		if (dirty) {
+			/* The scratch page is mapped to it */
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+			k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+			do_backing_store_page_out(page_out_location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+			*key = k_spin_lock(&z_mm_lock);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		}
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		arch_mem_map((uint8_t *)K_MEM_SCRATCH_AREA + (i * CONFIG_MMU_PAGE_SIZE),
+			     k_mem_page_frame_to_phys(pfs[i]), CONFIG_MMU_PAGE_SIZE,
+			     K_MEM_PERM_RW | K_MEM_CACHE_WB);
+	}
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_spin_unlock(&z_mm_lock, *key);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	do_backing_store_page_in_batch(locations, count);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	*key = k_spin_lock(&z_mm_lock);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+
+	arch_mem_unmap(K_MEM_SCRATCH_AREA, count * CONFIG_MMU_PAGE_SIZE);
+
+	for (size_t i = 0; i < count; i++) {
+		pf = pfs[i];
+		pos = addr + ((i + 1) * CONFIG_MMU_PAGE_SIZE);
+
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
+		frame_mapped_set(pf, pos);
+		arch_mem_page_in(pos, k_mem_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, locations[i]);
+		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
+			k_mem_paging_eviction_add(pf);
+		}
+	}
+
+	paging_stats_read_ahead_inc(faulting_thread, count);
+
+	return count;
+}
+
+/* Called once the page at addr was paged in to pf, before it is given to the
+ * eviction algorithm.
+ */
+static void read_ahead(void *addr, struct k_mem_page_frame *pf,
+		       k_spinlock_key_t *key, struct k_thread *faulting_thread)
+{
+	uint8_t *page = UINT_TO_POINTER(ROUND_DOWN(POINTER_TO_UINT(addr),
+						   CONFIG_MMU_PAGE_SIZE));
+
+	if (page == read_ahead_next) {
+		/* Don't evict the faulting page to make room for the others */
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_BUSY);
+		page += page_in_read_ahead(page, key, faulting_thread) *
+			CONFIG_MMU_PAGE_SIZE;
+		k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+	}
+	read_ahead_next = page + CONFIG_MMU_PAGE_SIZE;
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct k_mem_page_frame *pf;
@@ -1618,6 +2000,7 @@ static bool do_page_fault(void *addr, bool pin)
 	enum arch_page_location status;
 	bool result;
 	bool dirty = false;
+	uint32_t select_cycles;
 	struct k_thread *faulting_thread;
 	int ret;
 
@@ -1626,12 +2009,6 @@ static bool do_page_fault(void *addr, bool pin)
 
 	LOG_DBG("page fault at %p", addr);
 
-	/*
-	 * TODO: Add performance accounting:
-	 * - k_mem_paging_eviction_select() metrics
-	 *   * periodic timer execution time histogram (if implemented)
-	 */
-
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	/*
 	 * We do re-enable interrupts during the page-in/page-out operation
@@ -1713,13 +2090,13 @@ static bool do_page_fault(void *addr, bool pin)
 	pf = free_page_frame_list_get();
 	if (pf == NULL) {
 		/* Need to evict a page frame */
-		pf = do_eviction_select(&dirty);
+		pf = do_eviction_select(&dirty, &select_cycles);
 		__ASSERT(pf != NULL, "failed to get a page frame");
 		LOG_DBG("evicting %p at 0x%lx",
 			k_mem_page_frame_to_virt(pf),
 			k_mem_page_frame_to_phys(pf));
 
-		paging_stats_eviction_inc(faulting_thread, dirty);
+		paging_stats_eviction_inc(faulting_thread, dirty, select_cycles);
 	}
 	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
 	__ASSERT(ret == 0, "failed to prepare page frame");
@@ -1748,6 +2125,9 @@ static bool do_page_fault(void *addr, bool pin)
 
 	arch_mem_page_in(addr, k_mem_page_frame_to_phys(pf));
 	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	read_ahead(addr, pf, &key, faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
 		k_mem_paging_eviction_add(pf);
 	}
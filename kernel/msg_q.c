@@ -40,6 +40,75 @@ static inline bool handle_poll_events(struct k_msgq *msgq)
 #endif /* CONFIG_POLL */
 }
 
+static inline bool msgq_reserved(struct k_msgq *msgq)
+{
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	return msgq->reserve_ptr != NULL;
+#else
+	ARG_UNUSED(msgq);
+	return false;
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+}
+
+/* Wait queue of threads waiting to put or reserve a message.  Without
+ * zero-copy, a queue can't be both full and empty, so readers and writers
+ * never wait at the same time and share wait_q.
+ */
+static inline _wait_q_t *msgq_write_wait_q(struct k_msgq *msgq)
+{
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	return &msgq->write_wait_q;
+#else
+	return &msgq->wait_q;
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+}
+
+static inline char *msgq_next(struct k_msgq *msgq, char *ptr)
+{
+	ptr += msgq->msg_size;
+
+	return (ptr == msgq->buffer_end) ? msgq->buffer_start : ptr;
+}
+
+/* Copy a message into the slot at the write pointer.  While a slot is
+ * reserved, messages behind it are held back until it is committed.
+ */
+static void msgq_ring_put(struct k_msgq *msgq, const void *data)
+{
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+	(void)memcpy(msgq->write_ptr, (const char *)data, msgq->msg_size);
+	msgq->write_ptr = msgq_next(msgq, msgq->write_ptr);
+
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	if (msgq->reserve_ptr != NULL) {
+		msgq->pending_msgs++;
+		return;
+	}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
+	msgq->used_msgs++;
+}
+
+/* Copy out the message at the read pointer.  Returns false if its slot
+ * can't be reused yet, because an earlier slot is still claimed.
+ */
+static bool msgq_ring_get(struct k_msgq *msgq, void *data)
+{
+	(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
+	msgq->read_ptr = msgq_next(msgq, msgq->read_ptr);
+	msgq->used_msgs--;
+
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	if (msgq->claim_ptr != NULL) {
+		msgq->held_msgs++;
+		return false;
+	}
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
+	return true;
+}
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -51,6 +120,13 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	msgq->write_ptr = buffer;
 	msgq->used_msgs = 0;
 	msgq->flags = 0;
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	msgq->reserve_ptr = NULL;
+	msgq->claim_ptr = NULL;
+	msgq->pending_msgs = 0;
+	msgq->held_msgs = 0;
+	z_waitq_init(&msgq->write_wait_q);
+#endif /* CONFIG_MSGQ_ZERO_COPY */
 	z_waitq_init(&msgq->wait_q);
 	msgq->lock = (struct k_spinlock) {};
 #ifdef CONFIG_POLL
@@ -108,7 +184,8 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, cleanup, msgq);
 
-	CHECKIF(z_waitq_head(&msgq->wait_q) != NULL) {
+	CHECKIF((z_waitq_head(&msgq->wait_q) != NULL) ||
+		(z_waitq_head(msgq_write_wait_q(msgq)) != NULL)) {
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, cleanup, msgq, -EBUSY);
 
 		return -EBUSY;
@@ -138,10 +215,14 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
 
-	if (msgq->used_msgs < msgq->max_msgs) {
-		/* message queue isn't full */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
-		if (unlikely(pending_thread != NULL)) {
+	if (z_impl_k_msgq_num_free_get(msgq) > 0U) {
+		/* message queue isn't full; messages can't overtake a
+		 * reserved slot, so don't hand them over while one exists
+		 */
+		pending_thread = msgq_reserved(msgq) ? NULL :
+				 z_unpend_first_thread(&msgq->wait_q);
+		if (unlikely(pending_thread != NULL) &&
+		    (pending_thread->base.swap_data != NULL)) {
 			resched = true;
 
 			/* give message to waiting thread */
@@ -149,17 +230,18 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 			/* wake up waiting thread */
 			arch_thread_return_value_set(pending_thread, 0);
 			z_ready_thread(pending_thread);
+		} else if (unlikely(pending_thread != NULL)) {
+			/* put message in queue for a k_msgq_claim() waiter */
+			msgq_ring_put(msgq, data);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			resched = true;
 		} else {
 			/* put message in queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)data, msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
+			msgq_ring_put(msgq, data);
+			if (!msgq_reserved(msgq)) {
+				resched = handle_poll_events(msgq);
 			}
-			msgq->used_msgs++;
-			resched = handle_poll_events(msgq);
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -171,7 +253,8 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 		/* wait for put message success, failure, or timeout */
 		_current->base.swap_data = (void *) data;
 
-		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		result = z_pend_curr(&msgq->lock, key, msgq_write_wait_q(msgq),
+				     timeout);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
 		return result;
 	}
@@ -231,29 +314,20 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
 	if (msgq->used_msgs > 0U) {
-		/* take first available message from queue */
-		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
-		msgq->read_ptr += msgq->msg_size;
-		if (msgq->read_ptr == msgq->buffer_end) {
-			msgq->read_ptr = msgq->buffer_start;
-		}
-		msgq->used_msgs--;
-
-		/* handle first thread waiting to write (if any) */
-		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		/* take first available message from queue, and handle
+		 * first thread waiting to write (if any) if that freed a slot
+		 */
+		pending_thread = msgq_ring_get(msgq, data) ?
+				 z_unpend_first_thread(msgq_write_wait_q(msgq)) : NULL;
 		if (unlikely(pending_thread != NULL)) {
 			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
 
-			/* add thread's message to queue */
-			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
-					msgq->write_ptr < msgq->buffer_end);
-			(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
-			       msgq->msg_size);
-			msgq->write_ptr += msgq->msg_size;
-			if (msgq->write_ptr == msgq->buffer_end) {
-				msgq->write_ptr = msgq->buffer_start;
+			/* add thread's message to queue, unless it is a
+			 * k_msgq_reserve() waiter which takes the slot itself
+			 */
+			if (pending_thread->base.swap_data != NULL) {
+				msgq_ring_put(msgq, pending_thread->base.swap_data);
 			}
-			msgq->used_msgs++;
 
 			/* wake up waiting thread */
 			arch_thread_return_value_set(pending_thread, 0);
@@ -378,6 +452,270 @@ static inline int z_vrfy_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_
 #include <zephyr/syscalls/k_msgq_peek_at_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_MSGQ_ZERO_COPY
+/* Give queued messages to threads waiting to read, k_msgq_claim() waiters
+ * take theirs from the queue.  Each slot freed this way goes to the first
+ * thread waiting to write.  Returns true if any thread was woken.
+ */
+static bool msgq_wake_readers(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	struct k_thread *writer;
+	bool woken = false;
+
+	while (msgq->used_msgs > 0U) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		if ((pending_thread->base.swap_data != NULL) &&
+		    msgq_ring_get(msgq, pending_thread->base.swap_data)) {
+			writer = z_unpend_first_thread(&msgq->write_wait_q);
+			if (writer != NULL) {
+				if (writer->base.swap_data != NULL) {
+					msgq_ring_put(msgq, writer->base.swap_data);
+				}
+				arch_thread_return_value_set(writer, 0);
+				z_ready_thread(writer);
+			}
+		}
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+int z_impl_k_msgq_reserve(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	for (;;) {
+		if (msgq->reserve_ptr != NULL) {
+			result = -EBUSY;
+			break;
+		}
+
+		if (z_impl_k_msgq_num_free_get(msgq) > 0U) {
+			msgq->reserve_ptr = msgq->write_ptr;
+			msgq->write_ptr = msgq_next(msgq, msgq->write_ptr);
+			*slot = msgq->reserve_ptr;
+			result = 0;
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		/* wait for a free slot; a NULL message tells the getter
+		 * to leave the slot to us
+		 */
+		_current->base.swap_data = NULL;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->write_wait_q,
+				     timeout);
+		if (result != 0) {
+			return result;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_reserve(struct k_msgq *msgq, void **slot,
+					k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(slot, sizeof(*slot)));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(msgq->buffer_start,
+				      msgq->buffer_end - msgq->buffer_start));
+
+	return z_impl_k_msgq_reserve(msgq, slot, timeout);
+}
+#include <zephyr/syscalls/k_msgq_reserve_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_commit(struct k_msgq *msgq, void *slot)
+{
+	k_spinlock_key_t key;
+	bool resched;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((slot == NULL) || (slot != msgq->reserve_ptr)) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	/* the reserved message, and any put behind it, can now be read */
+	msgq->used_msgs += 1U + msgq->pending_msgs;
+	msgq->pending_msgs = 0;
+	msgq->reserve_ptr = NULL;
+
+	resched = msgq_wake_readers(msgq);
+	if (msgq->used_msgs > 0U) {
+		resched = handle_poll_events(msgq) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_commit(struct k_msgq *msgq, void *slot)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+
+	return z_impl_k_msgq_commit(msgq, slot);
+}
+#include <zephyr/syscalls/k_msgq_commit_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_claim(struct k_msgq *msgq, void **slot, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int result;
+
+	key = k_spin_lock(&msgq->lock);
+
+	for (;;) {
+		if (msgq->claim_ptr != NULL) {
+			result = -EBUSY;
+			break;
+		}
+
+		if (msgq->used_msgs > 0U) {
+			msgq->claim_ptr = msgq->read_ptr;
+			msgq->read_ptr = msgq_next(msgq, msgq->read_ptr);
+			msgq->used_msgs--;
+			msgq->held_msgs = 1;
+			*slot = msgq->claim_ptr;
+			result = 0;
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+			break;
+		}
+
+		/* wait for a message; a NULL buffer tells the putter to
+		 * queue it rather than hand it over
+		 */
+		_current->base.swap_data = NULL;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result != 0) {
+			return result;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_claim(struct k_msgq *msgq, void **slot,
+				      k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(slot, sizeof(*slot)));
+	K_OOPS(K_SYSCALL_MEMORY_READ(msgq->buffer_start,
+				     msgq->buffer_end - msgq->buffer_start));
+
+	return z_impl_k_msgq_claim(msgq, slot, timeout);
+}
+#include <zephyr/syscalls/k_msgq_claim_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_release(struct k_msgq *msgq, void *slot)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t freed;
+	bool resched = false;
+
+	key = k_spin_lock(&msgq->lock);
+
+	if ((slot == NULL) || (slot != msgq->claim_ptr)) {
+		k_spin_unlock(&msgq->lock, key);
+		return -EINVAL;
+	}
+
+	/* the claimed slot, and those read while it was claimed, are free */
+	freed = msgq->held_msgs;
+	msgq->held_msgs = 0;
+	msgq->claim_ptr = NULL;
+
+	/* handle threads waiting to write (if any) */
+	while (freed-- > 0U) {
+		pending_thread = z_unpend_first_thread(&msgq->write_wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		if (pending_thread->base.swap_data != NULL) {
+			msgq_ring_put(msgq, pending_thread->base.swap_data);
+		}
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	}
+
+	/* messages just put may be for threads waiting to read */
+	resched = msgq_wake_readers(msgq) || resched;
+	if (msgq->used_msgs > 0U) {
+		resched = handle_poll_events(msgq) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_release(struct k_msgq *msgq, void *slot)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+
+	return z_impl_k_msgq_release(msgq, slot);
+}
+#include <zephyr/syscalls/k_msgq_release_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+
 void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
@@ -389,16 +727,32 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
 
 	/* wake up any threads that are waiting to write */
-	for (pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	for (pending_thread = z_unpend_first_thread(msgq_write_wait_q(msgq));
 	     pending_thread != NULL;
-	     pending_thread = z_unpend_first_thread(&msgq->wait_q)) {
+	     pending_thread = z_unpend_first_thread(msgq_write_wait_q(msgq))) {
 		arch_thread_return_value_set(pending_thread, -ENOMSG);
 		z_ready_thread(pending_thread);
 		resched = true;
 	}
 
-	msgq->used_msgs = 0;
+#ifdef CONFIG_MSGQ_ZERO_COPY
+	/* Slots still handed out stay where they are: discarded messages
+	 * behind a claimed slot can't be reused before it is released, and
+	 * those behind a reserved slot are dropped from the write side.
+	 */
+	if (msgq->claim_ptr != NULL) {
+		msgq->held_msgs += msgq->used_msgs;
+	}
+	if (msgq->reserve_ptr != NULL) {
+		msgq->write_ptr = msgq_next(msgq, msgq->reserve_ptr);
+		msgq->pending_msgs = 0;
+	}
+	msgq->read_ptr = (msgq->reserve_ptr != NULL) ? msgq->reserve_ptr :
+						       msgq->write_ptr;
+#else
 	msgq->read_ptr = msgq->write_ptr;
+#endif /* CONFIG_MSGQ_ZERO_COPY */
+	msgq->used_msgs = 0;
 
 	if (resched) {
 		z_reschedule(&msgq->lock, key);
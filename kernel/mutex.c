@@ -39,6 +39,8 @@
 #include <zephyr/sys/check.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
+#include <zephyr/sys/mutex.h>
+#include <kernel_internal.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 /* We use a global spinlock here because some of the synchronization
@@ -292,6 +294,238 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 #include <zephyr/syscalls/k_mutex_unlock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+/*
+ * Contended sys_mutex support.
+ *
+ * An uncontended sys_mutex lives entirely in its word in user memory, which
+ * holds the owner thread ID (or zero) and is updated with compare-and-swap by
+ * the owner. Once a thread has to wait, Z_SYS_MUTEX_WAITERS is set in the
+ * word so that the owner's unlock comes here, and the k_mutex backing the
+ * sys_mutex is used to queue the waiters and to remember the owner for
+ * priority inheritance:
+ *
+ *   mutex->owner != NULL  <=>  Z_SYS_MUTEX_WAITERS is set in the word
+ *
+ * The word is only changed with Z_SYS_MUTEX_WAITERS set while holding the
+ * global mutex lock. Recursive locking is counted in user memory and never
+ * reaches the kernel.
+ *
+ * User threads can write anything to the word, so the kernel never trusts
+ * the owner it recorded: it is taken from the word again each time a thread
+ * comes to wait, and validated like a syscall argument before it gets
+ * boosted.
+ */
+
+#define FUTEX_OWNER(val) ((struct k_thread *)((val) & ~Z_SYS_MUTEX_WAITERS))
+
+/* The owner is read from user memory: make sure it is a live thread, that
+ * a user mode caller has been granted access to.
+ */
+static int futex_owner_check(struct k_thread *owner)
+{
+	struct k_object *ko = k_object_find(owner);
+
+	if ((_current->base.user_options & K_USER) != 0U) {
+		return k_object_validation_check(ko, owner, K_OBJ_THREAD,
+						 _OBJ_INIT_TRUE);
+	}
+
+	if ((ko == NULL) || (ko->type != K_OBJ_THREAD) ||
+	    ((ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Make @a owner, as found in the word, the owner the kernel boosts */
+static bool futex_owner_set(struct k_mutex *mutex, struct k_thread *owner)
+{
+	bool resched = false;
+
+	if (mutex->owner == owner) {
+		return false;
+	}
+
+	if ((mutex->owner != NULL) && (futex_owner_check(mutex->owner) == 0)) {
+		/* The word changed behind the kernel's back, drop the boost
+		 * given to the former owner.
+		 */
+		resched = adjust_owner_prio(mutex, mutex->owner_orig_prio);
+	}
+
+	mutex->owner = owner;
+	mutex->owner_orig_prio = owner->base.prio;
+	mutex->lock_count = 1U;
+
+	return resched;
+}
+
+int z_mutex_futex_lock(struct k_mutex *mutex, atomic_t *val,
+		       k_timeout_t timeout)
+{
+	struct k_thread *owner;
+	atomic_val_t old;
+	k_spinlock_key_t key;
+	bool resched = false;
+	int new_prio;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		old = atomic_get(val);
+
+		if (old == 0) {
+			if (atomic_cas(val, 0, (atomic_val_t)_current)) {
+				k_spin_unlock(&lock, key);
+
+				return 0;
+			}
+			continue;
+		}
+
+		owner = FUTEX_OWNER(old);
+
+		if (owner == _current) {
+			k_spin_unlock(&lock, key);
+
+			return -EINVAL;
+		}
+
+		ret = futex_owner_check(owner);
+		if (ret != 0) {
+			k_spin_unlock(&lock, key);
+
+			return ret;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+
+			return -EBUSY;
+		}
+
+		if (((old & Z_SYS_MUTEX_WAITERS) != 0) ||
+		    atomic_cas(val, old, old | Z_SYS_MUTEX_WAITERS)) {
+			break;
+		}
+	}
+
+	resched = futex_owner_set(mutex, owner);
+
+	new_prio = new_prio_for_inheritance(_current->base.prio,
+					    mutex->owner->base.prio);
+	if (z_is_prio_higher(new_prio, mutex->owner->base.prio)) {
+		resched = adjust_owner_prio(mutex, new_prio) || resched;
+	}
+
+	/* The unlocking thread writes our ID to the word before waking us */
+	if (z_pend_curr(&lock, key, &mutex->wait_q, timeout) == 0) {
+		return 0;
+	}
+
+	/* timed out */
+
+	key = k_spin_lock(&lock);
+
+	if (likely(mutex->owner != NULL)) {
+		struct k_thread *waiter = z_waitq_head(&mutex->wait_q);
+
+		new_prio = (waiter != NULL) ?
+			new_prio_for_inheritance(waiter->base.prio, mutex->owner_orig_prio) :
+			mutex->owner_orig_prio;
+
+		/* The owner may have exited in the meantime */
+		if (futex_owner_check(mutex->owner) == 0) {
+			resched = adjust_owner_prio(mutex, new_prio) || resched;
+		}
+
+		if (waiter == NULL) {
+			/* Nobody is left waiting: back to the fast path */
+			(void)atomic_and(val, ~Z_SYS_MUTEX_WAITERS);
+			mutex->owner = NULL;
+			mutex->lock_count = 0U;
+		}
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+int z_mutex_futex_unlock(struct k_mutex *mutex, atomic_t *val)
+{
+	struct k_thread *new_owner;
+	atomic_val_t old;
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	old = atomic_get(val);
+
+	if (old == 0) {
+		k_spin_unlock(&lock, key);
+
+		return -EINVAL;
+	}
+
+	if (FUTEX_OWNER(old) != _current) {
+		k_spin_unlock(&lock, key);
+
+		return -EPERM;
+	}
+
+	if ((old & Z_SYS_MUTEX_WAITERS) == 0) {
+		/* Uncontended, the caller just lost a race with a timeout */
+		atomic_set(val, 0);
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	if (mutex->owner != NULL) {
+		(void)futex_owner_set(mutex, _current);
+		(void)adjust_owner_prio(mutex, mutex->owner_orig_prio);
+	}
+
+	new_owner = z_unpend_first_thread(&mutex->wait_q);
+	if (new_owner == NULL) {
+		atomic_set(val, 0);
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	if (z_waitq_head(&mutex->wait_q) != NULL) {
+		atomic_set(val, (atomic_val_t)new_owner | Z_SYS_MUTEX_WAITERS);
+		mutex->owner = new_owner;
+		mutex->owner_orig_prio = new_owner->base.prio;
+	} else {
+		atomic_set(val, (atomic_val_t)new_owner);
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+	}
+
+	arch_thread_return_value_set(new_owner, 0);
+	z_ready_thread(new_owner);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
+
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static int init_mutex_obj_core_list(void)
 {
@@ -6,6 +6,7 @@
 #include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/math_extras.h>
 #include <ksched.h>
 #include <kthread.h>
 #include <wait_q.h>
@@ -34,6 +35,18 @@ static inline bool pipe_empty(struct k_pipe *pipe)
 	return ring_buf_is_empty(&pipe->buf);
 }
 
+static inline bool pipe_write_claimed(struct k_pipe *pipe)
+{
+	return IS_ENABLED(CONFIG_PIPE_ZERO_COPY) &&
+	       ((pipe->flags & PIPE_FLAG_WRITE_CLAIMED) != 0);
+}
+
+static inline bool pipe_read_claimed(struct k_pipe *pipe)
+{
+	return IS_ENABLED(CONFIG_PIPE_ZERO_COPY) &&
+	       ((pipe->flags & PIPE_FLAG_READ_CLAIMED) != 0);
+}
+
 static int wait_for(_wait_q_t *waitq, struct k_pipe *pipe, k_spinlock_key_t *key,
 		    k_timepoint_t time_limit, bool *need_resched)
 {
@@ -85,17 +98,68 @@ void z_impl_k_pipe_init(struct k_pipe *pipe, uint8_t *buffer, size_t buffer_size
 }
 
 struct pipe_buf_spec {
-	uint8_t * const data;
-	const size_t len;
+	const struct k_pipe_iovec *iov;
+	size_t iovcnt;
+	size_t idx;
+	size_t off;
+	size_t len;
 	size_t used;
 };
 
+static void spec_advance(struct pipe_buf_spec *spec, size_t size)
+{
+	spec->used += size;
+	spec->off += size;
+
+	/* also skips any empty segment, so idx only rests on data */
+	while ((spec->idx < spec->iovcnt) && (spec->off == spec->iov[spec->idx].len)) {
+		spec->idx++;
+		spec->off = 0;
+	}
+}
+
+static void spec_init(struct pipe_buf_spec *spec, const struct k_pipe_iovec *iov,
+		      size_t iovcnt)
+{
+	*spec = (struct pipe_buf_spec){ .iov = iov, .iovcnt = iovcnt };
+
+	for (size_t i = 0; i < iovcnt; i++) {
+		spec->len += iov[i].len;
+	}
+	spec_advance(spec, 0);
+}
+
+/* Current segment of a spec, only valid while spec->used < spec->len */
+static inline uint8_t *spec_data(struct pipe_buf_spec *spec)
+{
+	return (uint8_t *)spec->iov[spec->idx].base + spec->off;
+}
+
+static inline size_t spec_seg_len(struct pipe_buf_spec *spec)
+{
+	return spec->iov[spec->idx].len - spec->off;
+}
+
+static size_t spec_copy_in(struct pipe_buf_spec *spec, const uint8_t *data, size_t len)
+{
+	size_t copy_size, copied = 0;
+
+	while ((copied < len) && (spec->used < spec->len)) {
+		copy_size = MIN(len - copied, spec_seg_len(spec));
+		memcpy(spec_data(spec), &data[copied], copy_size);
+		copied += copy_size;
+		spec_advance(spec, copy_size);
+	}
+
+	return copied;
+}
+
 static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 				      const uint8_t *data, size_t len)
 {
 	struct k_thread *reader = NULL;
 	struct pipe_buf_spec *reader_buf;
-	size_t copy_size, written = 0;
+	size_t written = 0;
 
 	/*
 	 * Attempt a direct data copy to waiting readers if any.
@@ -104,6 +168,9 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 	 * on that thread's stack, and then the thread unpended only if it
 	 * received all the data it wanted, without racing with a potential
 	 * thread timeout/cancellation event.
+	 *
+	 * Threads waiting to claim data provide an empty spec: they are
+	 * woken up right away and the data is left to the ring buffer.
 	 */
 	do {
 		LOCK_SCHED_SPINLOCK {
@@ -113,12 +180,8 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 			}
 
 			reader_buf = reader->base.swap_data;
-			copy_size = MIN(len - written,
-					reader_buf->len - reader_buf->used);
-			memcpy(&reader_buf->data[reader_buf->used],
-			       &data[written], copy_size);
-			written += copy_size;
-			reader_buf->used += copy_size;
+			written += spec_copy_in(reader_buf, &data[written],
+						len - written);
 
 			if (reader_buf->used < reader_buf->len) {
 				/* This reader wants more: don't unpend. */
@@ -144,16 +207,14 @@ static size_t copy_to_pending_readers(struct k_pipe *pipe, bool *need_resched,
 	return written;
 }
 
-int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_timeout_t timeout)
+static int pipe_write(struct k_pipe *pipe, struct pipe_buf_spec *src, k_timeout_t timeout)
 {
 	int rc;
-	size_t written = 0;
+	size_t seg_len, written;
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 	bool need_resched = false;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, write, pipe, data, len, timeout);
-
 	if (unlikely(pipe_resetting(pipe))) {
 		rc = -ECANCELED;
 		goto exit;
@@ -165,6 +226,11 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
+		if (unlikely(pipe_write_claimed(pipe))) {
+			/* wait for k_pipe_write_finish() to release the ring */
+			goto wait;
+		}
+
 		if (pipe_empty(pipe)) {
 			if (IS_ENABLED(CONFIG_KERNEL_COHERENCE)) {
 				/*
@@ -178,11 +244,18 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 				 */
 				need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
 			} else if (pipe->waiting != 0) {
-				written += copy_to_pending_readers(pipe, &need_resched,
-								   &data[written],
-								   len - written);
-				if (written >= len) {
-					rc = written;
+				while (src->used < src->len) {
+					seg_len = spec_seg_len(src);
+					written = copy_to_pending_readers(pipe, &need_resched,
+									  spec_data(src), seg_len);
+					spec_advance(src, written);
+					if (written < seg_len) {
+						/* no reader left */
+						break;
+					}
+				}
+				if (src->used >= src->len) {
+					rc = src->used;
 					break;
 				}
 			}
@@ -192,22 +265,107 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 #endif /* CONFIG_POLL */
 		}
 
-		written += ring_buf_put(&pipe->buf, &data[written], len - written);
-		if (likely(written == len)) {
-			rc = written;
+		while (src->used < src->len) {
+			seg_len = spec_seg_len(src);
+			written = ring_buf_put(&pipe->buf, spec_data(src), seg_len);
+			spec_advance(src, written);
+			if (written < seg_len) {
+				/* ring buffer is full */
+				break;
+			}
+		}
+		if (likely(src->used == src->len)) {
+			rc = src->used;
 			break;
 		}
 
+wait:
 		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
 		if (rc != 0) {
 			if (rc == -EAGAIN) {
-				rc = written ? written : -EAGAIN;
+				rc = src->used ? src->used : -EAGAIN;
 			}
 			break;
 		}
 	}
 exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_timeout_t timeout)
+{
+	struct k_pipe_iovec iov = { (void *)data, len };
+	struct pipe_buf_spec src;
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, write, pipe, data, len, timeout);
+
+	spec_init(&src, &iov, 1);
+	rc = pipe_write(pipe, &src, timeout);
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, write, pipe, rc);
+
+	return rc;
+}
+
+static int pipe_read(struct k_pipe *pipe, struct pipe_buf_spec *dst, k_timeout_t timeout)
+{
+	int rc;
+	size_t seg_len, read;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	for (;;) {
+		/* while data is claimed, wait for k_pipe_read_finish() */
+		if (likely(!pipe_read_claimed(pipe))) {
+			if (pipe_full(pipe)) {
+				/* One or more pending writers may exist. */
+				need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+			}
+
+			while (dst->used < dst->len) {
+				seg_len = spec_seg_len(dst);
+				read = ring_buf_get(&pipe->buf, spec_data(dst), seg_len);
+				spec_advance(dst, read);
+				if (read < seg_len) {
+					/* ring buffer is empty */
+					break;
+				}
+			}
+			if (likely(dst->used == dst->len)) {
+				rc = dst->used;
+				break;
+			}
+		}
+
+		if (unlikely(pipe_closed(pipe))) {
+			rc = dst->used ? dst->used : -EPIPE;
+			break;
+		}
+
+		/* provide our "direct copy" info to potential writers */
+		_current->base.swap_data = dst;
+
+		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			if (rc == -EAGAIN) {
+				rc = dst->used ? dst->used : -EAGAIN;
+			}
+			break;
+		}
+	}
+exit:
 	if (need_resched) {
 		z_reschedule(&pipe->lock, key);
 	} else {
@@ -218,13 +376,182 @@ exit:
 
 int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout_t timeout)
 {
-	struct pipe_buf_spec buf = { data, len, 0 };
+	struct k_pipe_iovec iov = { data, len };
+	struct pipe_buf_spec dst;
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, read, pipe, data, len, timeout);
+
+	spec_init(&dst, &iov, 1);
+	rc = pipe_read(pipe, &dst, timeout);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, read, pipe, rc);
+
+	return rc;
+}
+
+#ifdef CONFIG_PIPE_ZERO_COPY
+/* Adds the length of the buffers to *total, which must fit the returned int */
+static int pipe_iov_total(const struct k_pipe_iovec *iov, size_t iovcnt, size_t *total)
+{
+	for (size_t i = 0; i < iovcnt; i++) {
+		if (size_add_overflow(*total, iov[i].len, total) || (*total > INT_MAX)) {
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+int z_impl_k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			 k_timeout_t timeout)
+{
+	struct pipe_buf_spec src;
+	size_t total = 0;
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, writev, pipe, iov, iovcnt, timeout);
+
+	rc = pipe_iov_total(iov, iovcnt, &total);
+	if (rc == 0) {
+		spec_init(&src, iov, iovcnt);
+		rc = pipe_write(pipe, &src, timeout);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, writev, pipe, rc);
+
+	return rc;
+}
+
+int z_impl_k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			k_timeout_t timeout)
+{
+	struct pipe_buf_spec dst;
+	size_t total = 0;
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, readv, pipe, iov, iovcnt, timeout);
+
+	rc = pipe_iov_total(iov, iovcnt, &total);
+	if (rc == 0) {
+		spec_init(&dst, iov, iovcnt);
+		rc = pipe_read(pipe, &dst, timeout);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, readv, pipe, rc);
+
+	return rc;
+}
+
+int z_impl_k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			      k_timeout_t timeout)
+{
 	int rc;
+	uint32_t claimed;
 	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	bool need_resched = false;
+
+	if (unlikely((len == 0) || (pipe->buf.size == 0))) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		if (unlikely(pipe_write_claimed(pipe))) {
+			rc = -EBUSY;
+			break;
+		}
+
+		claimed = ring_buf_put_claim(&pipe->buf, data, MIN(len, UINT32_MAX));
+		if (likely(claimed != 0)) {
+			pipe->flags |= PIPE_FLAG_WRITE_CLAIMED;
+			rc = claimed;
+			break;
+		}
+
+		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	k_spin_unlock(&pipe->lock, key);
+	return rc;
+}
+
+int z_impl_k_pipe_write_finish(struct k_pipe *pipe, size_t len)
+{
+	int rc;
+	bool was_empty;
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 	bool need_resched = false;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, read, pipe, data, len, timeout);
+	if (unlikely(!pipe_write_claimed(pipe) || (len > UINT32_MAX))) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	was_empty = pipe_empty(pipe);
+	rc = ring_buf_put_finish(&pipe->buf, len);
+	if (unlikely(rc != 0)) {
+		/* more than was claimed: the claim is kept */
+		goto exit;
+	}
+	pipe->flags &= ~PIPE_FLAG_WRITE_CLAIMED;
+
+	if (pipe->waiting != 0) {
+		/* writers held back by the claim */
+		need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+
+	if (was_empty && (len != 0)) {
+		if (pipe->waiting != 0) {
+			need_resched = z_sched_wake_all(&pipe->data, 0, NULL) || need_resched;
+		}
+#ifdef CONFIG_POLL
+		z_handle_obj_poll_events(&pipe->poll_events,
+					 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int z_impl_k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			     k_timeout_t timeout)
+{
+	int rc;
+	uint32_t claimed;
+	struct pipe_buf_spec none;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	bool need_resched = false;
+
+	if (unlikely((len == 0) || (pipe->buf.size == 0))) {
+		return -EINVAL;
+	}
+
+	/* an empty spec: writers wake us up but leave their data in the ring */
+	spec_init(&none, NULL, 0);
+
+	key = k_spin_lock(&pipe->lock);
 
 	if (unlikely(pipe_resetting(pipe))) {
 		rc = -ECANCELED;
@@ -232,35 +559,63 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 	}
 
 	for (;;) {
-		if (pipe_full(pipe)) {
-			/* One or more pending writers may exist. */
-			need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+		if (unlikely(pipe_read_claimed(pipe))) {
+			rc = -EBUSY;
+			break;
 		}
 
-		buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
-		if (likely(buf.used == len)) {
-			rc = buf.used;
+		claimed = ring_buf_get_claim(&pipe->buf, data, MIN(len, UINT32_MAX));
+		if (likely(claimed != 0)) {
+			pipe->flags |= PIPE_FLAG_READ_CLAIMED;
+			rc = claimed;
 			break;
 		}
 
 		if (unlikely(pipe_closed(pipe))) {
-			rc = buf.used ? buf.used : -EPIPE;
+			rc = -EPIPE;
 			break;
 		}
 
-		/* provide our "direct copy" info to potential writers */
-		_current->base.swap_data = &buf;
+		_current->base.swap_data = &none;
 
 		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
 		if (rc != 0) {
-			if (rc == -EAGAIN) {
-				rc = buf.used ? buf.used : -EAGAIN;
-			}
 			break;
 		}
 	}
 exit:
-	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, read, pipe, rc);
+	k_spin_unlock(&pipe->lock, key);
+	return rc;
+}
+
+int z_impl_k_pipe_read_finish(struct k_pipe *pipe, size_t len)
+{
+	int rc;
+	bool was_full;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+
+	if (unlikely(!pipe_read_claimed(pipe) || (len > UINT32_MAX))) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	was_full = pipe_full(pipe);
+	rc = ring_buf_get_finish(&pipe->buf, len);
+	if (unlikely(rc != 0)) {
+		/* more than was claimed: the claim is kept */
+		goto exit;
+	}
+	pipe->flags &= ~PIPE_FLAG_READ_CLAIMED;
+
+	if (pipe->waiting != 0) {
+		/* readers held back by the claim */
+		need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+		if (was_full && (len != 0)) {
+			need_resched = z_sched_wake_all(&pipe->space, 0, NULL) || need_resched;
+		}
+	}
+exit:
 	if (need_resched) {
 		z_reschedule(&pipe->lock, key);
 	} else {
@@ -268,12 +623,15 @@ exit:
 	}
 	return rc;
 }
+#endif /* CONFIG_PIPE_ZERO_COPY */
 
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
 	K_SPINLOCK(&pipe->lock) {
 		ring_buf_reset(&pipe->buf);
+		/* outstanding claims no longer refer to valid data or space */
+		pipe->flags &= ~(PIPE_FLAG_WRITE_CLAIMED | PIPE_FLAG_READ_CLAIMED);
 		if (likely(pipe->waiting != 0)) {
 			pipe->flags |= PIPE_FLAG_RESET;
 			z_sched_wake_all(&pipe->data, 0, NULL);
@@ -287,7 +645,8 @@ void z_impl_k_pipe_close(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, close, pipe);
 	K_SPINLOCK(&pipe->lock) {
-		pipe->flags = 0;
+		/* claims stay valid, so claimed data can still be finished */
+		pipe->flags &= PIPE_FLAG_WRITE_CLAIMED | PIPE_FLAG_READ_CLAIMED;
 		z_sched_wake_all(&pipe->data, 0, NULL);
 		z_sched_wake_all(&pipe->space, 0, NULL);
 	}
@@ -335,6 +694,127 @@ void z_vrfy_k_pipe_close(struct k_pipe *pipe)
 	z_impl_k_pipe_close(pipe);
 }
 #include <zephyr/syscalls/k_pipe_close_mrsh.c>
+
+#ifdef CONFIG_PIPE_ZERO_COPY
+/* Number of user iovecs copied in and handed to the kernel at a time */
+#define PIPE_IOV_BATCH 8
+
+static int pipe_xferv_user(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			   k_timeout_t timeout, bool write)
+{
+	struct k_pipe_iovec batch[PIPE_IOV_BATCH];
+	struct pipe_buf_spec spec;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t count, total, done = 0;
+	int rc = 0;
+
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	while (iovcnt > 0) {
+		count = MIN(iovcnt, ARRAY_SIZE(batch));
+		K_OOPS(k_usermode_from_copy(batch, iov, count * sizeof(*iov)));
+
+		total = done;
+		for (size_t i = 0; i < count; i++) {
+			if (write) {
+				K_OOPS(K_SYSCALL_MEMORY_READ(batch[i].base, batch[i].len));
+			} else {
+				K_OOPS(K_SYSCALL_MEMORY_WRITE(batch[i].base, batch[i].len));
+			}
+		}
+		if (pipe_iov_total(batch, count, &total) < 0) {
+			return -EINVAL;
+		}
+
+		spec_init(&spec, batch, count);
+		if (write) {
+			rc = pipe_write(pipe, &spec, sys_timepoint_timeout(end));
+		} else {
+			rc = pipe_read(pipe, &spec, sys_timepoint_timeout(end));
+		}
+		if (rc < 0) {
+			return ((rc == -EAGAIN) && (done != 0)) ? done : rc;
+		}
+
+		done += rc;
+		if ((size_t)rc < spec.len) {
+			break;
+		}
+		iov += count;
+		iovcnt -= count;
+	}
+
+	return done;
+}
+
+int z_vrfy_k_pipe_writev(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			 k_timeout_t timeout)
+{
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, writev, pipe, iov, iovcnt, timeout);
+
+	rc = pipe_xferv_user(pipe, iov, iovcnt, timeout, true);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, writev, pipe, rc);
+
+	return rc;
+}
+#include <zephyr/syscalls/k_pipe_writev_mrsh.c>
+
+int z_vrfy_k_pipe_readv(struct k_pipe *pipe, const struct k_pipe_iovec *iov, size_t iovcnt,
+			k_timeout_t timeout)
+{
+	int rc;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, readv, pipe, iov, iovcnt, timeout);
+
+	rc = pipe_xferv_user(pipe, iov, iovcnt, timeout, false);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_pipe, readv, pipe, rc);
+
+	return rc;
+}
+#include <zephyr/syscalls/k_pipe_readv_mrsh.c>
+
+int z_vrfy_k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			      k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(pipe->buf.buffer, pipe->buf.size));
+
+	return z_impl_k_pipe_write_claim(pipe, data, len, timeout);
+}
+#include <zephyr/syscalls/k_pipe_write_claim_mrsh.c>
+
+int z_vrfy_k_pipe_write_finish(struct k_pipe *pipe, size_t len)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	return z_impl_k_pipe_write_finish(pipe, len);
+}
+#include <zephyr/syscalls/k_pipe_write_finish_mrsh.c>
+
+int z_vrfy_k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+	K_OOPS(K_SYSCALL_MEMORY_READ(pipe->buf.buffer, pipe->buf.size));
+
+	return z_impl_k_pipe_read_claim(pipe, data, len, timeout);
+}
+#include <zephyr/syscalls/k_pipe_read_claim_mrsh.c>
+
+int z_vrfy_k_pipe_read_finish(struct k_pipe *pipe, size_t len)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	return z_impl_k_pipe_read_finish(pipe, len);
+}
+#include <zephyr/syscalls/k_pipe_read_finish_mrsh.c>
+#endif /* CONFIG_PIPE_ZERO_COPY */
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_OBJ_CORE_PIPE
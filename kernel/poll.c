@@ -35,11 +35,20 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
 
+/* Events of a k_poll_set stay registered with their object until they are
+ * removed from the set, and are kept at the head of the object's event list.
+ */
+static inline bool is_set_event(struct k_poll_event *event)
+{
+	return IS_ENABLED(CONFIG_POLL_SET) && (event->poller != NULL) &&
+	       (event->poller->mode == MODE_SET);
+}
+
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
 {
@@ -111,7 +120,7 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
+	if ((pending == NULL) || is_set_event(pending) ||
 		(z_sched_prio_cmp(poller_thread(pending->poller),
 							   poller_thread(poller)) > 0)) {
 		sys_dlist_append(events, &event->_node);
@@ -119,6 +128,9 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
+		if (is_set_event(pending)) {
+			continue;
+		}
 		if (z_sched_prio_cmp(poller_thread(poller),
 					poller_thread(pending->poller)) > 0) {
 			sys_dlist_insert(&pending->_node, &event->_node);
@@ -235,6 +247,14 @@ static inline int register_events(struct k_poll_event *events,
 		uint32_t state;
 
 		key = k_spin_lock(&lock);
+#ifdef CONFIG_QUEUE_LOCKFREE
+		if (events[ii].type == K_POLL_TYPE_DATA_AVAILABLE) {
+			/* Keep appenders off the lock-free path, which does
+			 * not signal poll events; must precede the check.
+			 */
+			atomic_set(&events[ii].queue->polled, 1);
+		}
+#endif
 		if (is_condition_met(&events[ii], &state)) {
 			set_event_ready(&events[ii], state);
 			poller->is_polling = false;
@@ -454,19 +474,77 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	return retcode;
 }
 
+#ifdef CONFIG_POLL_SET
+/* Private flag in k_poll_set_entry.flags: a one-shot entry has been reported */
+#define Z_POLL_SET_DISARMED BIT(31)
+
+/* must be called with interrupts locked */
+static bool signal_set_entry(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set_entry *entry =
+		CONTAINER_OF(event, struct k_poll_set_entry, event);
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set, poller);
+
+	entry->pending |= state;
+
+	if (((entry->flags & Z_POLL_SET_DISARMED) != 0U) ||
+	    sys_dnode_is_linked(&entry->ready_node)) {
+		return false;
+	}
+
+	sys_dlist_append(&set->ready, &entry->ready_node);
+
+	return z_sched_wake(&set->wait_q, 0, NULL);
+}
+#endif /* CONFIG_POLL_SET */
+
+/* must be called with interrupts locked
+ *
+ * Notifies every k_poll_set entry registered with the object, then removes
+ * and returns the first event of a k_poll() or k_work_poll caller, if any.
+ */
+static struct k_poll_event *signal_obj_poll_events(sys_dlist_t *events,
+						   uint32_t state, bool *woken)
+{
+#ifdef CONFIG_POLL_SET
+	sys_dnode_t *node;
+
+	for (node = sys_dlist_peek_head(events); node != NULL;
+	     node = sys_dlist_peek_next(events, node)) {
+		struct k_poll_event *event =
+			CONTAINER_OF(node, struct k_poll_event, _node);
+
+		if (!is_set_event(event)) {
+			sys_dlist_remove(node);
+			return event;
+		}
+
+		*woken = signal_set_entry(event, state) || *woken;
+	}
+
+	return NULL;
+#else
+	ARG_UNUSED(state);
+	ARG_UNUSED(woken);
+
+	return (struct k_poll_event *)sys_dlist_get(events);
+#endif /* CONFIG_POLL_SET */
+}
+
 bool z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state)
 {
 	struct k_poll_event *poll_event;
+	bool woken = false;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	poll_event = (struct k_poll_event *)sys_dlist_get(events);
+	poll_event = signal_obj_poll_events(events, state, &woken);
 	if (poll_event != NULL) {
 		(void) signal_poll_event(poll_event, state);
 	}
 
 	k_spin_unlock(&lock, key);
 
-	return (poll_event != NULL);
+	return (poll_event != NULL) || woken;
 }
 
 void z_impl_k_poll_signal_init(struct k_poll_signal *sig)
@@ -520,16 +598,22 @@ int z_impl_k_poll_signal_raise(struct k_poll_signal *sig, int result)
 {
 	k_spinlock_key_t key = k_spin_lock(&lock);
 	struct k_poll_event *poll_event;
+	bool woken = false;
 
 	sig->result = result;
 	sig->signaled = 1U;
 
-	poll_event = (struct k_poll_event *)sys_dlist_get(&sig->poll_events);
+	poll_event = signal_obj_poll_events(&sig->poll_events,
+					    K_POLL_STATE_SIGNALED, &woken);
 	if (poll_event == NULL) {
-		k_spin_unlock(&lock, key);
-
 		SYS_PORT_TRACING_FUNC(k_poll_api, signal_raise, sig, 0);
 
+		if (woken) {
+			z_reschedule(&lock, key);
+		} else {
+			k_spin_unlock(&lock, key);
+		}
+
 		return 0;
 	}
 
@@ -559,6 +643,220 @@ static inline void z_vrfy_k_poll_signal_reset(struct k_poll_signal *sig)
 
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_POLL_SET
+static sys_dlist_t *obj_poll_events(struct k_poll_event *event)
+{
+	switch (event->type) {
+	case K_POLL_TYPE_SEM_AVAILABLE:
+		return &event->sem->poll_events;
+	case K_POLL_TYPE_DATA_AVAILABLE:
+		return &event->queue->poll_events;
+	case K_POLL_TYPE_SIGNAL:
+		return &event->signal->poll_events;
+	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
+		return &event->msgq->poll_events;
+	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
+		return &event->pipe->poll_events;
+	default:
+		return NULL;
+	}
+}
+
+/* must be called with interrupts locked */
+static void set_entry_arm(struct k_poll_set_entry *entry, uint32_t flags)
+{
+	uint32_t state;
+
+	entry->flags = flags;
+	entry->pending = 0U;
+
+	/* Like the first k_poll() on an object, report a condition that is
+	 * already met instead of waiting for the next edge.
+	 */
+	if (is_condition_met(&entry->event, &state)) {
+		(void)signal_set_entry(&entry->event, state);
+	}
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_set_entry *entry,
+		   uint32_t flags)
+{
+	sys_dlist_t *events = obj_poll_events(&entry->event);
+	k_spinlock_key_t key;
+
+	__ASSERT((flags & ~(K_POLL_SET_EDGE | K_POLL_SET_ONESHOT)) == 0U,
+		 "invalid flags\n");
+
+	if (events == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (entry->event.poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EALREADY;
+	}
+
+#ifdef CONFIG_QUEUE_LOCKFREE
+	if (entry->event.type == K_POLL_TYPE_DATA_AVAILABLE) {
+		/* See register_events() */
+		atomic_set(&entry->event.queue->polled, 1);
+	}
+#endif
+
+	entry->event.poller = &set->poller;
+	entry->event.state = K_POLL_STATE_NOT_READY;
+	sys_dnode_init(&entry->ready_node);
+	sys_dlist_prepend(events, &entry->event._node);
+	set_entry_arm(entry, flags);
+
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_modify(struct k_poll_set *set, struct k_poll_set_entry *entry,
+		      uint32_t flags)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT((flags & ~(K_POLL_SET_EDGE | K_POLL_SET_ONESHOT)) == 0U,
+		 "invalid flags\n");
+
+	key = k_spin_lock(&lock);
+
+	if (entry->event.poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	if (sys_dnode_is_linked(&entry->ready_node)) {
+		sys_dlist_remove(&entry->ready_node);
+	}
+	set_entry_arm(entry, flags);
+
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_set_entry *entry)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (entry->event.poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	sys_dlist_remove(&entry->event._node);
+	if (sys_dnode_is_linked(&entry->ready_node)) {
+		sys_dlist_remove(&entry->ready_node);
+	}
+	entry->event.poller = NULL;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+/* must be called with interrupts locked
+ *
+ * Moves up to max entries off the ready list, after checking that their
+ * condition still holds: another thread may have taken the semaphore or
+ * drained the queue since the entry was queued.  Level-triggered entries
+ * go back to the tail of the list, to be checked again by the next wait.
+ */
+static int set_harvest(struct k_poll_set *set, struct k_poll_set_entry **ready,
+		       int max)
+{
+	sys_dlist_t requeue;
+	sys_dnode_t *node;
+	int count = 0;
+
+	sys_dlist_init(&requeue);
+
+	while ((count < max) && ((node = sys_dlist_get(&set->ready)) != NULL)) {
+		struct k_poll_set_entry *entry =
+			CONTAINER_OF(node, struct k_poll_set_entry, ready_node);
+		uint32_t state = entry->pending & K_POLL_STATE_CANCELLED;
+		uint32_t met;
+
+		entry->pending = 0U;
+
+		if (is_condition_met(&entry->event, &met)) {
+			state |= met;
+		}
+
+		if (state == K_POLL_STATE_NOT_READY) {
+			continue;
+		}
+
+		entry->event.state = state;
+		ready[count++] = entry;
+
+		if ((entry->flags & K_POLL_SET_ONESHOT) != 0U) {
+			entry->flags |= Z_POLL_SET_DISARMED;
+		} else if ((entry->flags & K_POLL_SET_EDGE) == 0U) {
+			sys_dlist_append(&requeue, node);
+		} else {
+			/* Edge-triggered: wait for the next signal */
+		}
+	}
+
+	while ((node = sys_dlist_get(&requeue)) != NULL) {
+		sys_dlist_append(&set->ready, node);
+	}
+
+	return count;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_set_entry **ready,
+		    int max, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int count;
+
+	__ASSERT(max > 0, "no room for ready entries\n");
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		count = set_harvest(set, ready, max);
+		if (count > 0) {
+			break;
+		}
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			count = -EAGAIN;
+			break;
+		}
+
+		if (z_pend_curr(&lock, key, &set->wait_q, timeout) != 0) {
+			return -EAGAIN;
+		}
+
+		key = k_spin_lock(&lock);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return count;
+}
+#endif /* CONFIG_POLL_SET */
+
 static void triggered_work_handler(struct k_work *work)
 {
 	struct k_work_poll *twork =
@@ -60,6 +60,11 @@ void z_impl_k_queue_init(struct k_queue *queue)
 	sys_sflist_init(&queue->data_q);
 	queue->lock = (struct k_spinlock) {};
 	z_waitq_init(&queue->wait_q);
+#ifdef CONFIG_QUEUE_LOCKFREE
+	atomic_ptr_clear(&queue->inbox);
+	atomic_clear(&queue->waiters);
+	atomic_clear(&queue->polled);
+#endif
 #if defined(CONFIG_POLL)
 	sys_dlist_init(&queue->poll_events);
 #endif
@@ -96,6 +101,162 @@ static inline bool handle_poll_events(struct k_queue *queue, uint32_t state)
 #endif /* CONFIG_POLL */
 }
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+/*
+ * Lock-free append fast path.
+ *
+ * While nobody waits on the queue, appenders push their node onto the
+ * inbox, a Treiber stack, with a single CAS and touch neither the lock
+ * nor the scheduler.  Every operation that works on data_q under the
+ * lock first moves the inbox over to the tail of data_q in arrival
+ * order, so FIFO ordering is preserved.  Popping is never done
+ * lock-free: only whole-inbox exchanges are, which keeps the scheme
+ * free of ABA problems with caller-owned nodes.
+ *
+ * A getter about to pend bumps queue->waiters before its last look at
+ * the inbox, and an appender re-checks waiters after its push.  With
+ * sequentially consistent atomics one of the two always sees the
+ * other, and in the latter case the appender goes through
+ * queue_kick() to hand the item over.  k_poll() sets queue->polled
+ * before checking the queue for the same reason.
+ */
+static void inbox_drain(struct k_queue *queue)
+{
+	sys_sfnode_t *node = atomic_ptr_set(&queue->inbox, NULL);
+	sys_sfnode_t *head = NULL;
+	sys_sfnode_t *tail = node;
+
+	if (node == NULL) {
+		return;
+	}
+
+	/* The inbox is newest first, reverse it */
+	while (node != NULL) {
+		sys_sfnode_t *next = z_sfnode_next_peek(node);
+
+		z_sfnode_next_set(node, head);
+		head = node;
+		node = next;
+	}
+
+	sys_sflist_append_list(&queue->data_q, head, tail);
+}
+
+static inline bool inbox_slow_path(struct k_queue *queue)
+{
+	return (atomic_get(&queue->waiters) != 0) ||
+	       (atomic_get(&queue->polled) != 0);
+}
+
+static void inbox_push(struct k_queue *queue, sys_sfnode_t *node)
+{
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&queue->inbox);
+		z_sfnode_next_set(node, head);
+	} while (!atomic_ptr_cas(&queue->inbox, head, node));
+}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
+/* Must be called with the queue lock held.  Moves pushed items into
+ * data_q and hands queued items to pended threads; returns true if
+ * the caller needs to reschedule.
+ */
+static bool queue_flush_locked(struct k_queue *queue)
+{
+#ifdef CONFIG_QUEUE_LOCKFREE
+	bool resched = false;
+
+	inbox_drain(queue);
+
+	while (!sys_sflist_is_empty(&queue->data_q)) {
+		struct k_thread *thread = z_unpend_first_thread(&queue->wait_q);
+
+		if (thread == NULL) {
+			break;
+		}
+
+		prepare_thread_to_run(thread,
+			z_queue_node_peek(sys_sflist_get_not_empty(&queue->data_q), true));
+		resched = true;
+	}
+
+	if (!sys_sflist_is_empty(&queue->data_q)) {
+		resched = handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE) || resched;
+	}
+
+	return resched;
+#else
+	ARG_UNUSED(queue);
+
+	return false;
+#endif /* CONFIG_QUEUE_LOCKFREE */
+}
+
+/* Make items appended without the lock visible in data_q */
+static inline void queue_sync(struct k_queue *queue)
+{
+#ifdef CONFIG_QUEUE_LOCKFREE
+	if (atomic_ptr_get(&queue->inbox) != NULL) {
+		k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+		inbox_drain(queue);
+		k_spin_unlock(&queue->lock, key);
+	}
+#else
+	ARG_UNUSED(queue);
+#endif /* CONFIG_QUEUE_LOCKFREE */
+}
+
+#ifdef CONFIG_QUEUE_LOCKFREE
+/* Hand items pushed on the inbox over to waiters or pollers */
+static void queue_kick(struct k_queue *queue)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+
+	if (queue_flush_locked(queue)) {
+		z_reschedule(&queue->lock, key);
+	} else {
+		k_spin_unlock(&queue->lock, key);
+	}
+}
+
+/* Returns false if the append must take the locked path instead */
+static bool queue_append_lockfree(struct k_queue *queue, void *data,
+				  bool alloc, int32_t *result)
+{
+	if (inbox_slow_path(queue)) {
+		return false;
+	}
+
+	*result = 0;
+
+	if (alloc) {
+		struct alloc_node *anode;
+
+		anode = z_thread_malloc(sizeof(*anode));
+		if (anode == NULL) {
+			*result = -ENOMEM;
+			return true;
+		}
+		anode->data = data;
+		sys_sfnode_init(&anode->node, 0x1);
+		data = anode;
+	} else {
+		sys_sfnode_init(data, 0x0);
+	}
+
+	inbox_push(queue, data);
+
+	if (inbox_slow_path(queue)) {
+		queue_kick(queue);
+	}
+
+	return true;
+}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
 void z_impl_k_queue_cancel_wait(struct k_queue *queue)
 {
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, cancel_wait, queue);
@@ -133,12 +294,23 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 			    bool alloc, bool is_append)
 {
 	struct k_thread *first_pending_thread;
-	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	k_spinlock_key_t key;
 	int32_t result = 0;
 	bool resched = false;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, queue_insert, queue, alloc);
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+	if (is_append && queue_append_lockfree(queue, data, alloc, &result)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, queue_insert, queue, alloc, result);
+
+		return result;
+	}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
+	key = k_spin_lock(&queue->lock);
+	resched = queue_flush_locked(queue);
+
 	if (is_append) {
 		prev = sys_sflist_peek_tail(&queue->data_q);
 	}
@@ -171,7 +343,7 @@ static int32_t queue_insert(struct k_queue *queue, void *prev, void *data,
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, queue_insert, queue, alloc, K_FOREVER);
 
 	sys_sflist_insert(&queue->data_q, prev, data);
-	resched = handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE);
+	resched = handle_poll_events(queue, K_POLL_STATE_DATA_AVAILABLE) || resched;
 
 out:
 	if (resched) {
@@ -269,6 +441,8 @@ int k_queue_append_list(struct k_queue *queue, void *head, void *tail)
 	k_spinlock_key_t key = k_spin_lock(&queue->lock);
 	struct k_thread *thread = NULL;
 
+	resched = queue_flush_locked(queue);
+
 	if (head != NULL) {
 		thread = z_unpend_first_thread(&queue->wait_q);
 	}
@@ -334,11 +508,37 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list)
 
 void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	k_spinlock_key_t key;
 	void *data;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get, queue, timeout);
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+	/* Polling an empty queue needs no lock */
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) && z_impl_k_queue_is_empty(queue)) {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, get, queue, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout, NULL);
+
+		return NULL;
+	}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
+	key = k_spin_lock(&queue->lock);
+
+#ifdef CONFIG_QUEUE_LOCKFREE
+	inbox_drain(queue);
+
+	if (sys_sflist_is_empty(&queue->data_q) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* Announce the wait before the last look at the inbox */
+		atomic_inc(&queue->waiters);
+		inbox_drain(queue);
+		if (!sys_sflist_is_empty(&queue->data_q)) {
+			atomic_dec(&queue->waiters);
+		}
+	}
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
 	if (likely(!sys_sflist_is_empty(&queue->data_q))) {
 		sys_sfnode_t *node;
 
@@ -363,6 +563,10 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 
 	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
 
+#ifdef CONFIG_QUEUE_LOCKFREE
+	atomic_dec(&queue->waiters);
+#endif /* CONFIG_QUEUE_LOCKFREE */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get, queue, timeout,
 		(ret != 0) ? NULL : _current->base.swap_data);
 
@@ -373,6 +577,8 @@ bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
 
+	queue_sync(queue);
+
 	bool ret = sys_sflist_find_and_remove(&queue->data_q, (sys_sfnode_t *)data);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, remove, queue, ret);
@@ -386,6 +592,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 	sys_sfnode_t *test;
 
+	queue_sync(queue);
+
 	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, test) {
 		if (test == (sys_sfnode_t *) data) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, unique_append, queue, false);
@@ -403,6 +611,8 @@ bool k_queue_unique_append(struct k_queue *queue, void *data)
 
 void *z_impl_k_queue_peek_head(struct k_queue *queue)
 {
+	queue_sync(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_head(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_head, queue, ret);
@@ -412,6 +622,8 @@ void *z_impl_k_queue_peek_head(struct k_queue *queue)
 
 void *z_impl_k_queue_peek_tail(struct k_queue *queue)
 {
+	queue_sync(queue);
+
 	void *ret = z_queue_node_peek(sys_sflist_peek_tail(&queue->data_q), false);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_queue, peek_tail, queue, ret);
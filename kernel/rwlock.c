@@ -0,0 +1,485 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file @brief reader/writer lock kernel services
+ *
+ * Any number of readers, or a single writer, may hold a reader/writer lock.
+ * Writers are preferred: once a writer waits for the lock, new readers wait
+ * as well, so that a steady stream of readers cannot starve writers. When a
+ * writer releases the lock it is handed to the next writer, if any, or else
+ * to all the waiting readers at once.
+ *
+ * With CONFIG_RWLOCK_PRIORITY_INHERITANCE the writer holding the lock runs
+ * at the priority of the highest priority waiter, following the same rules
+ * as mutexes. Readers are not tracked individually and so never inherit.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <ksched.h>
+#include <kthread.h>
+#include <wait_q.h>
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/check.h>
+
+/* As with mutexes, a global lock protects the writer priorities, which are
+ * not "part of" a single k_rwlock.
+ */
+static struct k_spinlock lock;
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static struct k_obj_type obj_type_rwlock;
+
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+static int k_rwlock_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_rwlock *rwlock;
+	k_spinlock_key_t key;
+
+	rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	key = k_spin_lock(&lock);
+	memcpy(stats, &rwlock->stats, sizeof(rwlock->stats));
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static int k_rwlock_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_rwlock *rwlock;
+	k_spinlock_key_t key;
+
+	rwlock = CONTAINER_OF(obj_core, struct k_rwlock, obj_core);
+	key = k_spin_lock(&lock);
+	rwlock->stats = (struct k_rwlock_stats) {
+		.max_readers = rwlock->readers,
+	};
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc rwlock_stats_desc = {
+	.raw_size = sizeof(struct k_rwlock_stats),
+	.query_size = sizeof(struct k_rwlock_stats),
+	.raw   = k_rwlock_stats_raw,
+	.query = k_rwlock_stats_raw,
+	.reset = k_rwlock_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+
+static inline void stats_read_locked(struct k_rwlock *rwlock, uint32_t count,
+				     bool contended)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	rwlock->stats.read_locks += count;
+	if (contended) {
+		rwlock->stats.read_contended += count;
+	}
+	rwlock->stats.max_readers = MAX(rwlock->stats.max_readers,
+					rwlock->readers);
+#else
+	ARG_UNUSED(rwlock);
+	ARG_UNUSED(count);
+	ARG_UNUSED(contended);
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+}
+
+static inline void stats_write_locked(struct k_rwlock *rwlock, bool contended)
+{
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	rwlock->stats.write_locks++;
+	if (contended) {
+		rwlock->stats.write_contended++;
+	}
+#else
+	ARG_UNUSED(rwlock);
+	ARG_UNUSED(contended);
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+}
+
+int z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	rwlock->writer = NULL;
+	rwlock->readers = 0U;
+
+	z_waitq_init(&rwlock->read_wait_q);
+	z_waitq_init(&rwlock->write_wait_q);
+
+	k_object_init(rwlock);
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+	k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	rwlock->stats = (struct k_rwlock_stats) {};
+	k_obj_core_stats_register(K_OBJ_CORE(rwlock), &rwlock->stats,
+				  sizeof(struct k_rwlock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_init(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_init_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_RWLOCK_PRIORITY_INHERITANCE
+static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
+{
+	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
+
+	new_prio = z_get_new_prio_with_ceiling(new_prio);
+
+	return new_prio;
+}
+
+static bool adjust_writer_prio(struct k_rwlock *rwlock, int32_t new_prio)
+{
+	if (rwlock->writer->base.prio != new_prio) {
+		return z_thread_prio_set(rwlock->writer, new_prio);
+	}
+	return false;
+}
+
+/* Boost the writer, if any, before the current thread pends on @a rwlock */
+static bool writer_prio_inherit(struct k_rwlock *rwlock)
+{
+	int32_t new_prio;
+
+	if (rwlock->writer == NULL) {
+		return false;
+	}
+
+	new_prio = new_prio_for_inheritance(_current->base.prio,
+					    rwlock->writer->base.prio);
+	if (z_is_prio_higher(new_prio, rwlock->writer->base.prio)) {
+		return adjust_writer_prio(rwlock, new_prio);
+	}
+
+	return false;
+}
+
+/* Recompute the writer priority from the threads still waiting */
+static bool writer_prio_update(struct k_rwlock *rwlock)
+{
+	struct k_thread *reader;
+	struct k_thread *writer;
+	int32_t new_prio;
+
+	if (rwlock->writer == NULL) {
+		return false;
+	}
+
+	new_prio = rwlock->writer_orig_prio;
+
+	reader = z_waitq_head(&rwlock->read_wait_q);
+	if (reader != NULL) {
+		new_prio = new_prio_for_inheritance(reader->base.prio, new_prio);
+	}
+
+	writer = z_waitq_head(&rwlock->write_wait_q);
+	if (writer != NULL) {
+		new_prio = new_prio_for_inheritance(writer->base.prio, new_prio);
+	}
+
+	return adjust_writer_prio(rwlock, new_prio);
+}
+#else
+#define writer_prio_inherit(rwlock) false
+#define writer_prio_update(rwlock) false
+#endif /* CONFIG_RWLOCK_PRIORITY_INHERITANCE */
+
+/* Hand the lock to the highest priority waiting writer, if any */
+static bool grant_writer(struct k_rwlock *rwlock)
+{
+	struct k_thread *thread = z_unpend_first_thread(&rwlock->write_wait_q);
+
+	if (thread == NULL) {
+		return false;
+	}
+
+	rwlock->writer = thread;
+	rwlock->writer_orig_prio = thread->base.prio;
+	stats_write_locked(rwlock, true);
+	arch_thread_return_value_set(thread, 0);
+	z_ready_thread(thread);
+
+	/* Readers may be waiting at a higher priority than the new writer */
+	(void)writer_prio_update(rwlock);
+
+	return true;
+}
+
+/* Hand the lock to all the waiting readers at once */
+static bool grant_readers(struct k_rwlock *rwlock)
+{
+	unsigned int woken = z_sched_wake_many(&rwlock->read_wait_q, UINT_MAX,
+					       0, NULL);
+
+	rwlock->readers += woken;
+	stats_read_locked(rwlock, woken, true);
+
+	return woken != 0U;
+}
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	bool resched;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	if (likely((rwlock->writer == NULL) &&
+		   (z_waitq_head(&rwlock->write_wait_q) == NULL))) {
+		rwlock->readers++;
+		stats_read_locked(rwlock, 1U, false);
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	if (rwlock->writer == _current) {
+		k_spin_unlock(&lock, key);
+
+		return -EDEADLK;
+	}
+
+	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
+		k_spin_unlock(&lock, key);
+
+		return -EBUSY;
+	}
+
+	resched = writer_prio_inherit(rwlock);
+
+	ret = z_pend_curr(&lock, key, &rwlock->read_wait_q, timeout);
+	if (ret == 0) {
+		return 0;
+	}
+
+	/* timed out */
+
+	key = k_spin_lock(&lock);
+
+	resched = writer_prio_update(rwlock) || resched;
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock,
+					    k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_read_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	CHECKIF(rwlock->readers == 0U) {
+		k_spin_unlock(&lock, key);
+
+		return -EINVAL;
+	}
+
+	rwlock->readers--;
+
+	if ((rwlock->readers == 0U) && grant_writer(rwlock)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_read_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	bool resched;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	if (likely((rwlock->writer == NULL) && (rwlock->readers == 0U))) {
+		rwlock->writer = _current;
+		rwlock->writer_orig_prio = _current->base.prio;
+		stats_write_locked(rwlock, false);
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	if (rwlock->writer == _current) {
+		k_spin_unlock(&lock, key);
+
+		return -EDEADLK;
+	}
+
+	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
+		k_spin_unlock(&lock, key);
+
+		return -EBUSY;
+	}
+
+	resched = writer_prio_inherit(rwlock);
+
+	ret = z_pend_curr(&lock, key, &rwlock->write_wait_q, timeout);
+	if (ret == 0) {
+		return 0;
+	}
+
+	/* timed out */
+
+	key = k_spin_lock(&lock);
+
+	resched = writer_prio_update(rwlock) || resched;
+
+	/*
+	 * Readers that were held back only because this thread was waiting
+	 * can now share the lock with the current readers.
+	 */
+	if ((rwlock->writer == NULL) &&
+	    (z_waitq_head(&rwlock->write_wait_q) == NULL)) {
+		resched = grant_readers(rwlock) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock,
+					     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <zephyr/syscalls/k_rwlock_write_lock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	bool resched;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	CHECKIF(rwlock->writer == NULL) {
+		return -EINVAL;
+	}
+
+	CHECKIF(rwlock->writer != _current) {
+		return -EPERM;
+	}
+
+	key = k_spin_lock(&lock);
+
+#ifdef CONFIG_RWLOCK_PRIORITY_INHERITANCE
+	(void)adjust_writer_prio(rwlock, rwlock->writer_orig_prio);
+#endif /* CONFIG_RWLOCK_PRIORITY_INHERITANCE */
+
+	rwlock->writer = NULL;
+
+	resched = grant_writer(rwlock) || grant_readers(rwlock);
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_unlock(rwlock);
+}
+#include <zephyr/syscalls/k_rwlock_write_unlock_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#ifdef CONFIG_OBJ_CORE_RWLOCK
+static int init_rwlock_obj_core_list(void)
+{
+	/* Initialize rwlock object type */
+
+	z_obj_type_init(&obj_type_rwlock, K_OBJ_TYPE_RWLOCK_ID,
+			offsetof(struct k_rwlock, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+	k_obj_type_stats_init(&obj_type_rwlock, &rwlock_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+
+	/* Initialize and link statically defined rwlocks */
+
+	STRUCT_SECTION_FOREACH(k_rwlock, rwlock) {
+		k_obj_core_init_and_link(K_OBJ_CORE(rwlock), &obj_type_rwlock);
+#ifdef CONFIG_OBJ_CORE_STATS_RWLOCK
+		k_obj_core_stats_register(K_OBJ_CORE(rwlock), &rwlock->stats,
+					  sizeof(struct k_rwlock_stats));
+#endif /* CONFIG_OBJ_CORE_STATS_RWLOCK */
+	}
+
+	return 0;
+}
+
+SYS_INIT(init_rwlock_obj_core_list, PRE_KERNEL_1,
+	 CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
+#endif /* CONFIG_OBJ_CORE_RWLOCK */
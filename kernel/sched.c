@@ -15,6 +15,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <stdbool.h>
+#include <limits.h>
 #include <kernel_internal.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/atomic.h>
@@ -59,6 +60,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_PER_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -67,35 +70,167 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
+}
+
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+/* Lock and number of queued threads of each CPU's run queue.  The lock
+ * nests inside _sched_spinlock, and no CPU holds two of them at once.
+ */
+static struct {
+	struct k_spinlock lock;
+	unsigned int count;
+} runq_state[CONFIG_MP_MAX_NUM_CPUS];
+
+static ALWAYS_INLINE bool runq_cpu_allowed(struct k_thread *thread,
+					   unsigned int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(cpu)) != 0;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cpu);
+
+	return true;
+#endif /* CONFIG_SCHED_CPU_MASK */
+}
+
+/* Queue a thread on the local CPU, where it was just running or is being
+ * made ready, unless another CPU its affinity mask allows has fewer
+ * threads queued: the least loaded one gets it then.
+ */
+static ALWAYS_INLINE uint8_t runq_home_cpu(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int id = _current_cpu->id;
+	unsigned int best_load = UINT_MAX;
+	uint8_t best = 0;
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		unsigned int cpu = (id + i) % num_cpus;
+		unsigned int load = runq_state[cpu].count;
+
+		if (runq_cpu_allowed(thread, cpu) && (load < best_load)) {
+			best = cpu;
+			best_load = load;
+		}
+	}
+
+	/* Same edge case as the pin-only variant: a thread with no CPU
+	 * enabled is parked on CPU 0.
+	 */
+	return best;
+}
+
+/* True if @a remote should run in preference to the local @a local */
+static ALWAYS_INLINE bool runq_should_steal(struct k_thread *remote,
+					   struct k_thread *local)
+{
+	if (local == NULL) {
+		return true;
+	}
+
+	if (CONFIG_SCHED_PER_CPU_RUNQ_STEAL_TOLERANCE == 0) {
+		return z_sched_prio_cmp(remote, local) > 0;
+	}
+
+	return (local->base.prio - remote->base.prio) >
+	       CONFIG_SCHED_PER_CPU_RUNQ_STEAL_TOLERANCE;
 }
 
+/* Best thread from the local run queue, or one stolen from another CPU
+ * if the local queue is empty or the remote thread out-ranks it by
+ * more than the configured tolerance.  The scan starts at the next CPU
+ * so that idle CPUs don't all converge on the same victim.
+ *
+ * Remote queues are only peeked at here: with _sched_spinlock held they
+ * can't change under us.  The remote lock is taken when the thread
+ * chosen is actually stolen, by runq_remove().
+ */
+static ALWAYS_INLINE struct k_thread *runq_best_steal(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	unsigned int id = _current_cpu->id;
+	struct k_thread *thread = NULL;
+
+	K_SPINLOCK(&runq_state[id].lock) {
+		thread = _priq_run_best(curr_cpu_runq());
+	}
+
+	for (unsigned int i = 1; i < num_cpus; i++) {
+		unsigned int cpu = (id + i) % num_cpus;
+		struct k_thread *remote;
+
+		if (runq_state[cpu].count == 0U) {
+			continue;
+		}
+
+		remote = _priq_run_best(&_kernel.cpus[cpu].ready_q.runq);
+		if ((remote != NULL) && runq_should_steal(remote, thread)) {
+			thread = remote;
+		}
+	}
+
+	return thread;
+}
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	uint8_t cpu = runq_home_cpu(thread);
+
+	thread->base.runq_cpu = cpu;
+	K_SPINLOCK(&runq_state[cpu].lock) {
+		_priq_run_add(thread_runq(thread), thread);
+		runq_state[cpu].count++;
+	}
+#else
 	_priq_run_add(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	/* Remote lock if the thread is stolen, or halted from elsewhere */
+	uint8_t cpu = thread->base.runq_cpu;
+
+	K_SPINLOCK(&runq_state[cpu].lock) {
+		_priq_run_remove(thread_runq(thread), thread);
+		runq_state[cpu].count--;
+	}
+#else
 	_priq_run_remove(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_yield(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	K_SPINLOCK(&runq_state[_current_cpu->id].lock) {
+		_priq_run_yield(curr_cpu_runq());
+	}
+#else
 	_priq_run_yield(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_PER_CPU_RUNQ
+	return runq_best_steal();
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -335,7 +470,17 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
-static void ready_thread(struct k_thread *thread)
+/* Accumulates the side effects of readying several threads so that the
+ * scheduler cache is refreshed, and IPIs flagged, once per batch rather
+ * than once per thread.  Must only be used with _sched_spinlock held.
+ */
+struct ready_batch {
+	unsigned int queued;
+	uint32_t ipi_mask;
+};
+
+static void ready_thread_batched(struct k_thread *thread,
+				 struct ready_batch *batch)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
 	__ASSERT_NO_MSG(arch_mem_coherent(thread));
@@ -348,12 +493,35 @@ static void ready_thread(struct k_thread *thread)
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
 		queue_thread(thread);
+		batch->queued++;
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+		if (thread != _current) {
+			z_sched_usage_ready(thread);
+		}
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
+#ifdef CONFIG_SMP
+		batch->ipi_mask |= (uint32_t)ipi_mask_create(thread);
+#endif /* CONFIG_SMP */
+	}
+}
+
+static void ready_batch_commit(struct ready_batch *batch)
+{
+	if (batch->queued != 0U) {
 		update_cache(0);
 
-		flag_ipi(ipi_mask_create(thread));
+		flag_ipi(batch->ipi_mask);
 	}
 }
 
+static void ready_thread(struct k_thread *thread)
+{
+	struct ready_batch batch = { 0 };
+
+	ready_thread_batched(thread, &batch);
+	ready_batch_commit(&batch);
+}
+
 void z_ready_thread(struct k_thread *thread)
 {
 	K_SPINLOCK(&_sched_spinlock) {
@@ -855,6 +1023,10 @@ void *z_get_next_switch_handle(void *interrupted)
 
 		z_sched_usage_switch(new_thread);
 
+#ifdef CONFIG_SCHED_IPI_STATS
+		z_sched_ipi_stats_update(old_thread != new_thread);
+#endif /* CONFIG_SCHED_IPI_STATS */
+
 		if (old_thread != new_thread) {
 			uint8_t  cpu_id;
 
@@ -914,18 +1086,43 @@ void *z_get_next_switch_handle(void *interrupted)
 }
 #endif /* CONFIG_USE_SWITCH */
 
-int z_unpend_all(_wait_q_t *wait_q)
+/* Unpend and ready up to @a max of the highest priority threads on
+ * @a wait_q while holding _sched_spinlock once for the whole batch.
+ */
+static unsigned int wake_many(_wait_q_t *wait_q, unsigned int max,
+			      bool set_retval, int swap_retval, void *swap_data)
 {
-	int need_sched = 0;
+	struct ready_batch batch = { 0 };
 	struct k_thread *thread;
+	unsigned int woken = 0U;
 
-	for (thread = z_waitq_head(wait_q); thread != NULL; thread = z_waitq_head(wait_q)) {
-		z_unpend_thread(thread);
-		z_ready_thread(thread);
-		need_sched = 1;
+	K_SPINLOCK(&_sched_spinlock) {
+		while (woken < max) {
+			thread = _priq_wait_best(&wait_q->waitq);
+			if (thread == NULL) {
+				break;
+			}
+
+			if (set_retval) {
+				z_thread_return_value_set_with_data(thread,
+								    swap_retval,
+								    swap_data);
+			}
+			unpend_thread_no_timeout(thread);
+			z_abort_thread_timeout(thread);
+			ready_thread_batched(thread, &batch);
+			woken++;
+		}
+
+		ready_batch_commit(&batch);
 	}
 
-	return need_sched;
+	return woken;
+}
+
+int z_unpend_all(_wait_q_t *wait_q)
+{
+	return (wake_many(wait_q, UINT_MAX, false, 0, NULL) != 0U) ? 1 : 0;
 }
 
 void init_ready_q(struct _ready_q *ready_q)
@@ -935,13 +1132,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_PER_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_PER_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
@@ -1201,14 +1398,17 @@ static inline k_tid_t z_vrfy_k_sched_current_thread_query(void)
 
 static inline void unpend_all(_wait_q_t *wait_q)
 {
+	struct ready_batch batch = { 0 };
 	struct k_thread *thread;
 
 	for (thread = z_waitq_head(wait_q); thread != NULL; thread = z_waitq_head(wait_q)) {
 		unpend_thread_no_timeout(thread);
 		z_abort_thread_timeout(thread);
 		arch_thread_return_value_set(thread, 0);
-		ready_thread(thread);
+		ready_thread_batched(thread, &batch);
 	}
+
+	ready_batch_commit(&batch);
 }
 
 #ifdef CONFIG_THREAD_ABORT_HOOK
@@ -1439,25 +1639,45 @@ static inline void z_vrfy_k_thread_abort(k_tid_t thread)
  */
 bool z_sched_wake(_wait_q_t *wait_q, int swap_retval, void *swap_data)
 {
+	return wake_many(wait_q, 1U, true, swap_retval, swap_data) != 0U;
+}
+
+unsigned int z_sched_wake_many(_wait_q_t *wait_q, unsigned int count,
+			       int swap_retval, void *swap_data)
+{
+	return wake_many(wait_q, count, true, swap_retval, swap_data);
+}
+
+#ifdef CONFIG_EVENTS
+unsigned int z_sched_wake_event_list(struct k_thread *head)
+{
+	struct ready_batch batch = { 0 };
 	struct k_thread *thread;
-	bool ret = false;
+	unsigned int woken = 0U;
 
 	K_SPINLOCK(&_sched_spinlock) {
-		thread = _priq_wait_best(&wait_q->waitq);
+		for (thread = head; thread != NULL; thread = thread->next_event_link) {
+			thread->no_wake_on_timeout = false;
 
-		if (thread != NULL) {
-			z_thread_return_value_set_with_data(thread,
-							    swap_retval,
-							    swap_data);
-			unpend_thread_no_timeout(thread);
-			z_abort_thread_timeout(thread);
-			ready_thread(thread);
-			ret = true;
+			if ((thread->base.thread_state &
+			     (_THREAD_DEAD | _THREAD_ABORTING)) != 0U) {
+				continue;
+			}
+
+			if (thread->base.pended_on != NULL) {
+				unpend_thread_no_timeout(thread);
+			}
+			z_mark_thread_as_not_sleeping(thread);
+			ready_thread_batched(thread, &batch);
+			woken++;
 		}
+
+		ready_batch_commit(&batch);
 	}
 
-	return ret;
+	return woken;
 }
+#endif /* CONFIG_EVENTS */
 
 int z_sched_wait(struct k_spinlock *lock, k_spinlock_key_t key,
 		 _wait_q_t *wait_q, k_timeout_t timeout, void **data)
@@ -165,19 +165,10 @@ out:
 
 void z_impl_k_sem_reset(struct k_sem *sem)
 {
-	struct k_thread *thread;
 	k_spinlock_key_t key = k_spin_lock(&lock);
-	bool resched = false;
+	bool resched;
 
-	while (true) {
-		thread = z_unpend_first_thread(&sem->wait_q);
-		if (thread == NULL) {
-			break;
-		}
-		resched = true;
-		arch_thread_return_value_set(thread, -EAGAIN);
-		z_ready_thread(thread);
-	}
+	resched = z_sched_wake_many(&sem->wait_q, UINT_MAX, -EAGAIN, NULL) != 0U;
 	sem->count = 0;
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, reset, sem);
@@ -928,6 +928,12 @@ void z_thread_mark_switched_in(void)
 void z_thread_mark_switched_out(void)
 {
 #if defined(CONFIG_SCHED_THREAD_USAGE) && !defined(CONFIG_USE_SWITCH)
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+	if (z_is_thread_ready(_current)) {
+		/* Preempted: ready again, but no longer running */
+		z_sched_usage_ready(_current);
+	}
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
 	z_sched_usage_stop();
 #endif /*CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
@@ -988,6 +994,25 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_IPI_STATS
+		stats->ipi.sent         += tmp_stats.ipi.sent;
+		stats->ipi.useful       += tmp_stats.ipi.useful;
+		stats->ipi.spurious     += tmp_stats.ipi.spurious;
+#endif /* CONFIG_SCHED_IPI_STATS */
+#ifdef CONFIG_SCHED_CPU_LOAD
+		stats->load.avg_1s      += tmp_stats.load.avg_1s;
+		stats->load.avg_10s     += tmp_stats.load.avg_10s;
+		stats->load.avg_60s     += tmp_stats.load.avg_60s;
+#endif /* CONFIG_SCHED_CPU_LOAD */
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+		stats->ready_latency.total += tmp_stats.ready_latency.total;
+		stats->ready_latency.count += tmp_stats.ready_latency.count;
+		stats->ready_latency.longest = MAX(stats->ready_latency.longest,
+						   tmp_stats.ready_latency.longest);
+		for (unsigned int j = 0; j < CONFIG_SCHED_THREAD_READY_LATENCY_BUCKETS; j++) {
+			stats->ready_latency.buckets[j] += tmp_stats.ready_latency.buckets[j];
+		}
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
@@ -11,9 +11,11 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
+/* Sorted timeout queue, or the wheel overflow list with CONFIG_TIMEOUT_WHEEL */
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
 
 /*
@@ -40,6 +42,230 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+/*
+ * Hierarchical timer wheel.  In this mode the dticks field of a queued
+ * timeout holds its absolute expiry tick instead of a delta against the
+ * previous entry.
+ *
+ * A timeout is stored on the lowest level whose span contains both its
+ * expiry and curr_tick, in the slot selected by the expiry bits of that
+ * level.  Anything beyond the top level goes on the (unsorted) overflow
+ * list.  All timeouts in a level 0 slot therefore expire on the same
+ * tick and are kept in insertion order.  Whenever curr_tick enters a
+ * new slot of a higher level, that slot is cascaded down.
+ *
+ * Occupied slots are tracked in a bitmap per level.  Bits are cleared
+ * lazily when an empty slot is found, so removal is a plain list unlink.
+ */
+#define WHEEL_BITS   6
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint64_t wheel_used[WHEEL_LEVELS];
+
+/* Earliest pending timeout, or NULL when it must be looked up again */
+static struct _timeout *wheel_first;
+
+static struct _timeout *earliest(sys_dlist_t *list)
+{
+	struct _timeout *t, *ret = NULL;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+		if ((ret == NULL) || (t->dticks < ret->dticks)) {
+			ret = t;
+		}
+	}
+
+	return ret;
+}
+
+static struct _timeout *wheel_search(void)
+{
+	for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		unsigned int idx = (curr_tick >> (WHEEL_BITS * lvl)) & WHEEL_MASK;
+		uint64_t used = wheel_used[lvl] & ~(BIT64(idx) - 1U);
+
+		while (used != 0U) {
+			unsigned int slot = u64_count_trailing_zeros(used);
+			sys_dlist_t *list = &wheel[lvl][slot];
+
+			if (!sys_dlist_is_empty(list)) {
+				/* Level 0 slots hold a single expiry tick */
+				return (lvl == 0) ?
+					CONTAINER_OF(sys_dlist_peek_head(list),
+						     struct _timeout, node) :
+					earliest(list);
+			}
+
+			wheel_used[lvl] &= ~BIT64(slot);
+			used &= ~BIT64(slot);
+		}
+	}
+
+	return earliest(&timeout_list);
+}
+
+static struct _timeout *first(void)
+{
+	if (wheel_first == NULL) {
+		wheel_first = wheel_search();
+	}
+
+	return wheel_first;
+}
+
+/* Ticks from curr_tick until the first timeout expires */
+static int64_t first_dticks(const struct _timeout *t)
+{
+	return t->dticks - (int64_t)curr_tick;
+}
+
+static void wheel_add(struct _timeout *to)
+{
+	uint64_t expiry = (uint64_t)to->dticks;
+	sys_dlist_t *list = &timeout_list;
+
+	for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		unsigned int shift = WHEEL_BITS * (lvl + 1);
+
+		if ((expiry >> shift) == (curr_tick >> shift)) {
+			unsigned int slot = (expiry >> (shift - WHEEL_BITS)) & WHEEL_MASK;
+
+			list = &wheel[lvl][slot];
+			if ((wheel_used[lvl] & BIT64(slot)) == 0U) {
+				sys_dlist_init(list);
+				wheel_used[lvl] |= BIT64(slot);
+			}
+			break;
+		}
+	}
+
+	sys_dlist_append(list, &to->node);
+}
+
+static void insert_timeout(struct _timeout *to)
+{
+	wheel_add(to);
+
+	if ((wheel_first != NULL) && (to->dticks < wheel_first->dticks)) {
+		wheel_first = to;
+	}
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	if (t == wheel_first) {
+		wheel_first = NULL;
+	}
+
+	sys_dlist_remove(&t->node);
+}
+
+static void insert_timeouts(sys_dlist_t *batch)
+{
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(batch)) != NULL) {
+		insert_timeout(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* Wheel insertions are constant time, no need to sort a batch */
+static void sort_timeouts(sys_dlist_t *batch)
+{
+	ARG_UNUSED(batch);
+}
+
+/* Move curr_tick forward.  No timeout may expire before the new value. */
+static void advance(int64_t ticks)
+{
+	uint64_t prev = curr_tick;
+	unsigned int top = WHEEL_BITS * WHEEL_LEVELS;
+
+	curr_tick += ticks;
+
+	if ((curr_tick >> top) != (prev >> top)) {
+		struct _timeout *t, *tmp;
+
+		SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&timeout_list, t, tmp, node) {
+			if (((uint64_t)t->dticks >> top) == (curr_tick >> top)) {
+				sys_dlist_remove(&t->node);
+				wheel_add(t);
+			}
+		}
+	}
+
+	for (int lvl = WHEEL_LEVELS - 1; lvl > 0; lvl--) {
+		unsigned int shift = WHEEL_BITS * lvl;
+		unsigned int slot = (curr_tick >> shift) & WHEEL_MASK;
+		sys_dnode_t *node;
+
+		if (((curr_tick >> shift) == (prev >> shift)) ||
+		    ((wheel_used[lvl] & BIT64(slot)) == 0U)) {
+			continue;
+		}
+
+		/* Everything in this slot now lands on a lower level */
+		wheel_used[lvl] &= ~BIT64(slot);
+		while ((node = sys_dlist_get(&wheel[lvl][slot])) != NULL) {
+			wheel_add(CONTAINER_OF(node, struct _timeout, node));
+		}
+	}
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - curr_tick;
+}
+
+#ifdef CONFIG_ZTEST
+/* Shift every pending timeout along when the tick count is forced */
+static void wheel_rebase(uint64_t tick)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+
+	for (int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		for (unsigned int slot = 0; slot < WHEEL_SLOTS; slot++) {
+			if ((wheel_used[lvl] & BIT64(slot)) == 0U) {
+				continue;
+			}
+
+			while ((node = sys_dlist_get(&wheel[lvl][slot])) != NULL) {
+				sys_dlist_append(&pending, node);
+			}
+		}
+		wheel_used[lvl] = 0U;
+	}
+
+	while ((node = sys_dlist_get(&timeout_list)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	struct _timeout *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&pending, t, node) {
+		t->dticks += (int64_t)(tick - curr_tick);
+	}
+
+	curr_tick = tick;
+	wheel_first = NULL;
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		wheel_add(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+#endif /* CONFIG_ZTEST */
+
+#else
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -54,6 +280,29 @@ static struct _timeout *next(struct _timeout *t)
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+static int64_t first_dticks(const struct _timeout *t)
+{
+	return t->dticks;
+}
+
+static void insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -63,6 +312,162 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* Expiry of a batch entry whose dticks still holds the ticks of its
+ * k_timeout_t, for sorting.  Relative timeouts are placed using @p now.
+ */
+static k_ticks_t batch_key(sys_dnode_t *node, k_ticks_t now)
+{
+	struct _timeout *to = CONTAINER_OF(node, struct _timeout, node);
+
+	if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) && (Z_TICK_ABS(to->dticks) >= 0)) {
+		return Z_TICK_ABS(to->dticks);
+	}
+
+	return now + to->dticks;
+}
+
+/* Sort a batch by expiry, without the timeout lock.  This is a bottom-up
+ * merge sort of the batch as a singly linked list, which is stable so that
+ * equal expiries keep their order.
+ */
+static void sort_timeouts(sys_dlist_t *batch)
+{
+	k_ticks_t now = sys_clock_tick_get();
+	sys_dnode_t *list = NULL;
+	sys_dnode_t *tail = NULL;
+	sys_dnode_t *node;
+	size_t run = 1;
+	size_t merges;
+
+	/* Unlink the batch into a singly linked list, keeping its order */
+	while ((node = sys_dlist_get(batch)) != NULL) {
+		node->next = NULL;
+		if (tail == NULL) {
+			list = node;
+		} else {
+			tail->next = node;
+		}
+		tail = node;
+	}
+
+	do {
+		sys_dnode_t *p = list;
+
+		list = NULL;
+		tail = NULL;
+		merges = 0;
+
+		while (p != NULL) {
+			sys_dnode_t *q = p;
+			size_t psize = 0;
+			size_t qsize = run;
+
+			merges++;
+			while ((psize < run) && (q != NULL)) {
+				psize++;
+				q = q->next;
+			}
+
+			while ((psize > 0) || ((qsize > 0) && (q != NULL))) {
+				sys_dnode_t *e;
+
+				if ((psize == 0) ||
+				    ((qsize > 0) && (q != NULL) &&
+				     (batch_key(q, now) < batch_key(p, now)))) {
+					e = q;
+					q = q->next;
+					qsize--;
+				} else {
+					e = p;
+					p = p->next;
+					psize--;
+				}
+
+				if (tail == NULL) {
+					list = e;
+				} else {
+					tail->next = e;
+				}
+				tail = e;
+			}
+
+			p = q;
+		}
+
+		if (tail != NULL) {
+			tail->next = NULL;
+		}
+		run *= 2;
+	} while (merges > 1);
+
+	while (list != NULL) {
+		node = list;
+		list = list->next;
+		sys_dlist_append(batch, node);
+	}
+}
+
+/* Insert a batch of timeouts sorted by sort_timeouts() in one pass over
+ * the queue, without ever walking back.
+ */
+static void insert_timeouts(sys_dlist_t *batch)
+{
+	sys_dnode_t *node;
+	struct _timeout *t = first();
+	k_ticks_t base = 0;
+
+	/* base is the expiry of the entry before t */
+	while ((node = sys_dlist_get(batch)) != NULL) {
+		struct _timeout *to = CONTAINER_OF(node, struct _timeout, node);
+
+		/* Mixing relative and absolute timeouts, the clock may have
+		 * moved since the batch was sorted: start over from the head
+		 * for an entry that is now out of order.
+		 */
+		if (to->dticks < base) {
+			t = first();
+			base = 0;
+		}
+
+		to->dticks -= base;
+		while ((t != NULL) && (t->dticks <= to->dticks)) {
+			to->dticks -= t->dticks;
+			base += t->dticks;
+			t = next(t);
+		}
+
+		if (t != NULL) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+		} else {
+			sys_dlist_append(&timeout_list, &to->node);
+		}
+		base += to->dticks;
+	}
+}
+
+static void advance(int64_t ticks)
+{
+	curr_tick += ticks;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -91,15 +496,36 @@ static int32_t next_timeout(void)
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((first_dticks(to) - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, first_dticks(to) - ticks_elapsed);
 	}
 
 	return ret;
 }
 
+/* must be locked: dticks of a timeout being added */
+static k_ticks_t timeout_dticks(k_timeout_t timeout, int32_t ticks_elapsed)
+{
+	k_ticks_t dticks;
+
+	if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
+	    (Z_TICK_ABS(timeout.ticks) >= 0)) {
+		k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+
+		dticks = MAX(1, ticks);
+	} else {
+		dticks = timeout.ticks + 1 + ticks_elapsed;
+	}
+
+	if (IS_ENABLED(CONFIG_TIMEOUT_WHEEL)) {
+		dticks += curr_tick;
+	}
+
+	return dticks;
+}
+
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 		   k_timeout_t timeout)
 {
@@ -115,31 +541,59 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+		to->dticks = timeout_dticks(timeout, elapsed());
 
-		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
-		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
-			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+		insert_timeout(to);
 
-			to->dticks = MAX(1, ticks);
-		} else {
-			to->dticks = timeout.ticks + 1 + elapsed();
+		if (to == first() && announce_remaining == 0) {
+			sys_clock_set_timeout(next_timeout(), false);
 		}
+	}
+}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
+void z_add_timeouts(sys_dlist_t *batch)
+{
+	struct _timeout *to;
+
+	/* Only the merge into the queue needs the lock */
+	sort_timeouts(batch);
+
+	K_SPINLOCK(&timeout_lock) {
+		struct _timeout *old_first = first();
+		int32_t ticks_elapsed = elapsed();
+
+		SYS_DLIST_FOR_EACH_CONTAINER(batch, to, node) {
+#ifdef CONFIG_KERNEL_COHERENCE
+			__ASSERT_NO_MSG(arch_mem_coherent(to));
+#endif /* CONFIG_KERNEL_COHERENCE */
+			__ASSERT_NO_MSG(to->dticks != K_TICKS_FOREVER);
+
+			to->dticks = timeout_dticks(Z_TIMEOUT_TICKS(to->dticks),
+						    ticks_elapsed);
 		}
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
+		insert_timeouts(batch);
+
+		if ((first() != old_first) && (announce_remaining == 0)) {
+			sys_clock_set_timeout(next_timeout(), false);
 		}
+	}
+}
 
-		if (to == first() && announce_remaining == 0) {
+void z_abort_timeouts(void *const *objs, size_t count, size_t offset)
+{
+	K_SPINLOCK(&timeout_lock) {
+		struct _timeout *old_first = first();
+
+		for (size_t i = 0; i < count; i++) {
+			struct _timeout *to = (struct _timeout *)((uint8_t *)objs[i] + offset);
+
+			if (sys_dnode_is_linked(&to->node)) {
+				remove_timeout(to);
+			}
+		}
+
+		if (first() != old_first) {
 			sys_clock_set_timeout(next_timeout(), false);
 		}
 	}
@@ -164,21 +618,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -237,13 +676,13 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (first_dticks(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = first_dticks(t);
 
-		curr_tick += dt;
 		t->dticks = 0;
 		remove_timeout(t);
+		advance(dt);
 
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
@@ -251,11 +690,13 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
+#ifndef CONFIG_TIMEOUT_WHEEL
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* !CONFIG_TIMEOUT_WHEEL */
 
-	curr_tick += announce_remaining;
+	advance(announce_remaining);
 	announce_remaining = 0;
 
 	sys_clock_set_timeout(next_timeout(), false);
@@ -339,7 +780,13 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		wheel_rebase(tick);
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -32,6 +33,141 @@ static uint32_t usage_now(void)
 	return (now == 0) ? 1 : now;
 }
 
+#ifdef CONFIG_SCHED_CPU_LOAD
+/*
+ * CPU load averages are updated once per 100 ms period, with the share of
+ * the period spent running non-idle threads, using the decay factors
+ * exp(-0.1 / T) for time constants T of 1, 10 and 60 seconds, in 16-bit
+ * fixed point. A window spanning several periods, such as a tickless idle
+ * stretch, folds all its whole periods in at once.
+ */
+#define CPU_LOAD_SHIFT       16
+#define CPU_LOAD_ONE         BIT(CPU_LOAD_SHIFT)
+#define CPU_LOAD_PERIODS_SEC 10
+#define CPU_LOAD_NUM_AVG     3
+
+static const uint32_t cpu_load_decay[CPU_LOAD_NUM_AVG] = {
+	59299,    /* 1 s */
+	64884,    /* 10 s */
+	65427,    /* 60 s */
+};
+
+struct cpu_load {
+	uint32_t elapsed;                 /* cycles into the current period */
+	uint32_t busy;                    /* non-idle cycles in the period */
+	uint32_t avg[CPU_LOAD_NUM_AVG];   /* fixed point load averages */
+};
+
+static struct cpu_load cpu_loads[CONFIG_MP_MAX_NUM_CPUS];
+
+static uint32_t cpu_load_period(void)
+{
+#ifdef CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS
+	return (uint32_t)(timing_freq_get() / CPU_LOAD_PERIODS_SEC);
+#else
+	return (uint32_t)(sys_clock_hw_cycles_per_sec() / CPU_LOAD_PERIODS_SEC);
+#endif /* CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS */
+}
+
+/* Fixed point decay^n, by squaring: at most 32 steps whatever n is */
+static uint32_t cpu_load_decay_pow(uint32_t decay, uint32_t n)
+{
+	uint32_t result = CPU_LOAD_ONE;
+
+	while ((n != 0U) && (result != 0U)) {
+		if ((n & 1U) != 0U) {
+			result = ((uint64_t)result * decay) >> CPU_LOAD_SHIFT;
+		}
+		decay = ((uint64_t)decay * decay) >> CPU_LOAD_SHIFT;
+		n >>= 1;
+	}
+
+	return result;
+}
+
+/* Fold n periods with the same fixed point load into the averages */
+static void cpu_load_fold(struct cpu_load *cl, uint32_t load, uint32_t n)
+{
+	for (unsigned int i = 0; i < CPU_LOAD_NUM_AVG; i++) {
+		uint32_t decay = cpu_load_decay_pow(cpu_load_decay[i], n);
+
+		cl->avg[i] = ((uint64_t)cl->avg[i] * decay +
+			      (uint64_t)load * (CPU_LOAD_ONE - decay)) >> CPU_LOAD_SHIFT;
+	}
+}
+
+static void cpu_load_account(struct cpu_load *cl, uint32_t cycles, bool busy)
+{
+	uint32_t period = cpu_load_period();
+	uint32_t left;
+	uint32_t n;
+
+	if (period == 0U) {
+		return;
+	}
+
+	/* The cycle rate may have changed since the period started */
+	left = (cl->elapsed < period) ? (period - cl->elapsed) : 0U;
+
+	if (cycles < left) {
+		cl->elapsed += cycles;
+		cl->busy += busy ? cycles : 0U;
+		return;
+	}
+
+	/* Complete the current period */
+	cl->busy += busy ? left : 0U;
+	cpu_load_fold(cl, MIN(((uint64_t)cl->busy << CPU_LOAD_SHIFT) / period,
+			      CPU_LOAD_ONE), 1U);
+	cycles -= left;
+
+	/* Then all the whole periods of the window at once */
+	n = cycles / period;
+	if (n != 0U) {
+		cpu_load_fold(cl, busy ? CPU_LOAD_ONE : 0U, n);
+	}
+
+	cl->elapsed = cycles % period;
+	cl->busy = busy ? cl->elapsed : 0U;
+}
+
+static void cpu_load_get_locked(uint8_t cpu_id, struct k_cpu_load_stats *stats)
+{
+	struct _cpu *cpu = &_kernel.cpus[cpu_id];
+	struct cpu_load cl = cpu_loads[cpu_id];
+	uint32_t u0 = cpu->usage0;
+
+	/*
+	 * Account for the window in progress on a copy, so that a CPU in a
+	 * long tickless idle, or running the same thread for long, shows
+	 * up to date loads without waiting for its next context switch.
+	 */
+	if ((u0 != 0) && cpu->usage->track_usage) {
+		cpu_load_account(&cl, usage_now() - u0,
+				 cpu->current != cpu->idle_thread);
+	}
+
+	stats->avg_1s  = (cl.avg[0] * 1000ULL) >> CPU_LOAD_SHIFT;
+	stats->avg_10s = (cl.avg[1] * 1000ULL) >> CPU_LOAD_SHIFT;
+	stats->avg_60s = (cl.avg[2] * 1000ULL) >> CPU_LOAD_SHIFT;
+}
+
+int k_cpu_load_get(int cpu, struct k_cpu_load_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	if ((stats == NULL) || (cpu < 0) || (cpu >= arch_num_cpus())) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&usage_lock);
+	cpu_load_get_locked(cpu, stats);
+	k_spin_unlock(&usage_lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SCHED_CPU_LOAD */
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 {
@@ -39,6 +175,11 @@ static void sched_cpu_update_usage(struct _cpu *cpu, uint32_t cycles)
 		return;
 	}
 
+#ifdef CONFIG_SCHED_CPU_LOAD
+	cpu_load_account(&cpu_loads[cpu->id], cycles,
+			 cpu->current != cpu->idle_thread);
+#endif /* CONFIG_SCHED_CPU_LOAD */
+
 	if (cpu->current != cpu->idle_thread) {
 		cpu->usage->total += cycles;
 
@@ -71,8 +212,62 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	/* A single write, only read back when the thread is switched in */
+	if (!z_is_idle_thread_object(thread)) {
+		thread->base.ready0 = usage_now();
+	}
+}
+
+static void ready_latency_update(struct k_ready_latency_stats *stats,
+				 uint32_t cycles)
+{
+	unsigned int bucket = (cycles > 1U) ?
+			      (31U - u32_count_leading_zeros(cycles)) : 0U;
+
+	stats->total += cycles;
+	stats->count++;
+	if (stats->longest < cycles) {
+		stats->longest = cycles;
+	}
+	stats->buckets[MIN(bucket, CONFIG_SCHED_THREAD_READY_LATENCY_BUCKETS - 1)]++;
+}
+
+static void sched_ready_latency(struct k_thread *thread)
+{
+	uint32_t ready0 = thread->base.ready0;
+	uint32_t cycles;
+	k_spinlock_key_t key;
+
+	if (ready0 == 0) {
+		return;
+	}
+
+	cycles = usage_now() - ready0;
+	thread->base.ready0 = 0;
+
+	key = k_spin_lock(&usage_lock);
+
+	if (thread->base.usage.track_usage) {
+		ready_latency_update(&thread->base.usage.ready_latency, cycles);
+	}
+
+	if (_current_cpu->usage->track_usage) {
+		ready_latency_update(&_current_cpu->usage->ready_latency, cycles);
+	}
+
+	k_spin_unlock(&usage_lock, key);
+}
+#else
+#define sched_ready_latency(thread)   do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
+	sched_ready_latency(thread);
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	k_spinlock_key_t  key;
 
@@ -164,8 +359,20 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 	stats->idle_cycles =
 		_kernel.cpus[cpu_id].idle_thread->base.usage.total;
 
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+	stats->ready_latency = _kernel.cpus[cpu_id].usage->ready_latency;
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
+
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	(void)k_ipi_stats_get(cpu_id, &stats->ipi);
+#endif /* CONFIG_SCHED_IPI_STATS */
+
+#ifdef CONFIG_SCHED_CPU_LOAD
+	cpu_load_get_locked(cpu_id, &stats->load);
+#endif /* CONFIG_SCHED_CPU_LOAD */
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -221,6 +428,10 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+	stats->ready_latency = thread->base.usage.ready_latency;
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -382,6 +593,9 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+	stats->ready_latency = (struct k_ready_latency_stats) {};
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
 
 	if (thread != _current_cpu->current) {
 
@@ -92,6 +92,43 @@ static inline void init_work_cancel(struct z_work_canceller *canceler,
 	sys_slist_append(&pending_cancels, &canceler->node);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* List of pending flushes of work items on work queue pools.
+ *
+ * A flusher queued behind the work item could be taken by another
+ * worker while the item is still running, so these wait in a
+ * canceller record instead, and are released when the item goes
+ * idle.
+ */
+static sys_slist_t pending_flushes;
+
+static inline bool queue_is_pool(const struct k_work_q *queue)
+{
+	return !sys_slist_is_empty(&queue->workers);
+}
+
+/* Complete all flushes of a work item on a work queue pool.
+ *
+ * Invoked with work lock held.
+ *
+ * @param work the work item that has gone idle.
+ */
+static void finalize_pool_flush_locked(struct k_work *work)
+{
+	struct z_work_canceller *wc, *tmp;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&pending_flushes, wc, tmp, node) {
+		if (wc->work == work) {
+			sys_slist_remove(&pending_flushes, prev, &wc->node);
+			k_sem_give(&wc->sem);
+		} else {
+			prev = &wc->node;
+		}
+	}
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Complete flushing of a work item.
  *
  * Invoked with work lock held.
@@ -209,10 +246,84 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (queue_is_pool(queue)) {
+			struct k_work_q_worker *worker;
+
+			if (!sys_slist_find_and_remove(&queue->pending, &work->node)) {
+				SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+					if (sys_slist_find_and_remove(&worker->pending,
+								      &work->node)) {
+						break;
+					}
+				}
+			}
+
+			/* Nothing is left to flush unless it is running */
+			if (!flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+				finalize_pool_flush_locked(work);
+			}
+			return;
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
 		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
 	}
 }
 
+/* Test whether the current thread is a thread of a work queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to check
+ */
+static inline bool queue_thread_is_current(struct k_work_q *queue)
+{
+	if (_current == &queue->thread) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work_q_worker *worker;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (_current == &worker->thread) {
+			return true;
+		}
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return false;
+}
+
+/* Select the list a work item is queued on.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue the work is submitted to
+ * @param cpu the preferred CPU, or -1
+ *
+ * @return the pending list of the worker serving @p cpu if there is one,
+ * otherwise the pending list of @p queue.
+ */
+static inline sys_slist_t *queue_list_locked(struct k_work_q *queue, int cpu)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work_q_worker *worker;
+
+	if (cpu >= 0) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+			if (worker->cpu == cpu) {
+				return &worker->pending;
+			}
+		}
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return &queue->pending;
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -249,20 +360,22 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
  *
  * @param work to be submitted
  *
+ * @param cpu the preferred CPU, or -1
+ *
  * @retval 1 if successfully queued
  * @retval -EINVAL if no queue is provided
  * @retval -ENODEV if the queue is not started
  * @retval -EBUSY if the submission was rejected (draining, plugged)
  */
 static inline int queue_submit_locked(struct k_work_q *queue,
-				      struct k_work *work)
+				      struct k_work *work, int cpu)
 {
 	if (queue == NULL) {
 		return -EINVAL;
 	}
 
 	int ret;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = queue_thread_is_current(queue) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -280,7 +393,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
-		sys_slist_append(&queue->pending, &work->node);
+		sys_slist_append(queue_list_locked(queue, cpu), &work->node);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -306,6 +419,8 @@ static inline int queue_submit_locked(struct k_work_q *queue,
  * the queue it was submitted to.  That may or may not be the queue provided
  * on input.
  *
+ * @param cpu the preferred CPU, or -1
+ *
  * @retval 0 if work was already submitted to a queue
  * @retval 1 if work was not submitted and has been queued to @p queue
  * @retval 2 if work was running and has been queued to the queue that was
@@ -314,8 +429,8 @@ static inline int queue_submit_locked(struct k_work_q *queue,
  * @retval -EINVAL if no queue is provided
  * @retval -ENODEV if the queue is not started
  */
-static int submit_to_queue_locked(struct k_work *work,
-				  struct k_work_q **queuep)
+static int submit_to_queue_cpu_locked(struct k_work *work,
+				      struct k_work_q **queuep, int cpu)
 {
 	int ret = 0;
 
@@ -342,7 +457,7 @@ static int submit_to_queue_locked(struct k_work *work,
 			ret = 2;
 		}
 
-		int rc = queue_submit_locked(*queuep, work);
+		int rc = queue_submit_locked(*queuep, work, cpu);
 
 		if (rc < 0) {
 			ret = rc;
@@ -361,6 +476,16 @@ static int submit_to_queue_locked(struct k_work *work,
 	return ret;
 }
 
+/* Attempt to submit work to a queue, with no CPU preference.
+ *
+ * See submit_to_queue_cpu_locked().
+ */
+static inline int submit_to_queue_locked(struct k_work *work,
+					 struct k_work_q **queuep)
+{
+	return submit_to_queue_cpu_locked(work, queuep, -1);
+}
+
 /* Submit work to a queue but do not yield the current thread.
  *
  * Intended for internal use.
@@ -408,6 +533,27 @@ int k_work_submit_to_queue(struct k_work_q *queue,
 	return ret;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+int k_work_submit_to_queue_cpu(struct k_work_q *queue,
+			       struct k_work *work, int cpu)
+{
+	__ASSERT_NO_MSG(work != NULL);
+	__ASSERT_NO_MSG(work->handler != NULL);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	int ret = submit_to_queue_cpu_locked(work, &queue, cpu);
+
+	k_spin_unlock(&lock, key);
+
+	if (ret > 0) {
+		z_reschedule_unlocked();
+	}
+
+	return ret;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_submit(struct k_work *work)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, submit, work);
@@ -427,29 +573,41 @@ int k_work_submit(struct k_work *work)
  * Sleeps.
  *
  * @param work the work item that is to be flushed
- * @param flusher state used to synchronize the flush
+ * @param sync state used to synchronize the flush
  *
- * @retval true if work is queued or running.  If this happens the
- * caller must take the flusher semaphore after releasing the lock.
- *
- * @retval false otherwise.  No wait required.
+ * @return the semaphore the caller must take after releasing the lock if
+ * work is queued or running, otherwise NULL.  No wait required.
  */
-static bool work_flush_locked(struct k_work *work,
-			      struct z_work_flusher *flusher)
+static struct k_sem *work_flush_locked(struct k_work *work,
+				       struct k_work_sync *sync)
 {
 	bool need_flush = (flags_get(&work->flags)
 			   & (K_WORK_QUEUED | K_WORK_RUNNING)) != 0U;
 
-	if (need_flush) {
-		struct k_work_q *queue = work->queue;
+	if (!need_flush) {
+		return NULL;
+	}
 
-		__ASSERT_NO_MSG(queue != NULL);
+	struct k_work_q *queue = work->queue;
 
-		queue_flusher_locked(queue, work, flusher);
-		notify_queue_locked(queue);
+	__ASSERT_NO_MSG(queue != NULL);
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue_is_pool(queue)) {
+		struct z_work_canceller *waiter = &sync->canceller;
+
+		k_sem_init(&waiter->sem, 0, 1);
+		waiter->work = work;
+		sys_slist_append(&pending_flushes, &waiter->node);
+
+		return &waiter->sem;
 	}
+#endif /* CONFIG_WORKQUEUE_POOL */
 
-	return need_flush;
+	queue_flusher_locked(queue, work, &sync->flusher);
+	notify_queue_locked(queue);
+
+	return &sync->flusher.sem;
 }
 
 bool k_work_flush(struct k_work *work,
@@ -465,10 +623,10 @@ bool k_work_flush(struct k_work *work,
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, flush, work);
 
-	struct z_work_flusher *flusher = &sync->flusher;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	bool need_flush = work_flush_locked(work, flusher);
+	struct k_sem *sem = work_flush_locked(work, sync);
+	bool need_flush = (sem != NULL);
 
 	k_spin_unlock(&lock, key);
 
@@ -476,7 +634,7 @@ bool k_work_flush(struct k_work *work,
 	if (need_flush) {
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work, flush, work, K_FOREVER);
 
-		k_sem_take(&flusher->sem, K_FOREVER);
+		k_sem_take(sem, K_FOREVER);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, flush, work, need_flush);
@@ -599,16 +757,173 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* Take the first work item from a list that is not running.
+ *
+ * An item resubmitted while its handler runs on another worker is
+ * left in place.  It becomes eligible when the handler returns, so the
+ * handler is never re-entered.
+ *
+ * Invoked with work lock held.
+ *
+ * @param list the pending list to take from
+ */
+static sys_snode_t *take_idle_locked(sys_slist_t *list)
+{
+	struct k_work *work;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, work, node) {
+		if (!flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+			sys_slist_remove(list, prev, &work->node);
+			return &work->node;
+		}
+		prev = &work->node;
+	}
+
+	return NULL;
+}
+
+/* Take the next work item for a thread of a work queue pool.
+ *
+ * Work submitted for the CPU of the worker comes first, then work
+ * submitted without a preference.  Rather than go idle the thread then
+ * steals work submitted for the other workers.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue served by the thread
+ * @param self the worker that is the thread, or NULL for the queue thread
+ */
+static sys_snode_t *pool_take_locked(struct k_work_q *queue,
+				     struct k_work_q_worker *self)
+{
+	struct k_work_q_worker *worker;
+	sys_snode_t *next = NULL;
+
+	if (self != NULL) {
+		next = take_idle_locked(&self->pending);
+	}
+
+	if (next == NULL) {
+		next = take_idle_locked(&queue->pending);
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (next != NULL) {
+			break;
+		}
+		if (worker != self) {
+			next = take_idle_locked(&worker->pending);
+		}
+	}
+
+	return next;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+/* Take the next work item for a work queue thread.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue served by the thread
+ * @param worker the pool worker that is the thread, or NULL for the
+ * queue thread
+ */
+static inline sys_snode_t *queue_take_locked(struct k_work_q *queue,
+					     struct k_work_q_worker *worker)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue_is_pool(queue)) {
+		return pool_take_locked(queue, worker);
+	}
+#else
+	ARG_UNUSED(worker);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return sys_slist_get(&queue->pending);
+}
+
+/* Test whether any work is waiting on a queue.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool queue_has_pending_locked(struct k_work_q *queue)
+{
+	if (!sys_slist_is_empty(&queue->pending)) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work_q_worker *worker;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (!sys_slist_is_empty(&worker->pending)) {
+			return true;
+		}
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return false;
+}
+
+/* Mark that a queue thread has work active that's not on a pending list.
+ *
+ * Invoked with work lock held.
+ */
+static inline void queue_busy_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	queue->nr_busy++;
+#endif /* CONFIG_WORKQUEUE_POOL */
+	flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+/* Mark that a queue thread has completed its active work.
+ *
+ * The queue stays busy while any other thread has work active.
+ *
+ * Invoked with work lock held.
+ */
+static inline void queue_idle_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (--queue->nr_busy != 0U) {
+		return;
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+	flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+/* Account for a queue thread exiting on a stop request.
+ *
+ * Invoked with work lock held.
+ *
+ * @return true if and only if no other thread of the queue is left.
+ */
+static inline bool queue_thread_exit_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	return --queue->nr_threads == 0U;
+#else
+	ARG_UNUSED(queue);
+
+	return true;
+#endif /* CONFIG_WORKQUEUE_POOL */
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
+ * @param worker_ptr pointer to the pool worker structure, or NULL for the
+ * queue thread
  */
-static void work_queue_main(void *workq_ptr, void *p2, void *p3)
+static void work_queue_main(void *workq_ptr, void *worker_ptr, void *p3)
 {
-	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
+	struct k_work_q_worker *worker = (struct k_work_q_worker *)worker_ptr;
 
 	while (true) {
 		sys_snode_t *node;
@@ -618,12 +933,12 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_take_locked(queue, worker);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+			queue_busy_locked(queue);
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -641,7 +956,8 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -655,8 +971,11 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			(void)z_sched_wake_all(&queue->drainq, 1, NULL);
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
+			 * On a pool the last thread to exit does this.
 			 */
-			flags_set(&queue->flags, 0);
+			if (queue_thread_exit_locked(queue)) {
+				flags_set(&queue->flags, 0);
+			}
 			k_spin_unlock(&lock, key);
 			return;
 		} else {
@@ -697,8 +1016,13 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
 			finalize_cancel_locked(work);
 		}
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (queue_is_pool(queue) && !flag_test(&work->flags, K_WORK_QUEUED_BIT)) {
+			finalize_pool_flush_locked(work);
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		queue_idle_locked(queue);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -738,6 +1062,11 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#ifdef CONFIG_WORKQUEUE_POOL
+	sys_slist_init(&queue->workers);
+	queue->nr_busy = 0U;
+	queue->nr_threads = 1U;
+#endif /* CONFIG_WORKQUEUE_POOL */
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -766,6 +1095,61 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+int k_work_queue_add_worker(struct k_work_q *queue,
+			    struct k_work_q_worker *worker,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int cpu)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(worker);
+	__ASSERT_NO_MSG(stack);
+
+	if (cpu >= CONFIG_MP_MAX_NUM_CPUS) {
+		return -EINVAL;
+	}
+
+	if (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT)) {
+		return -ENODEV;
+	}
+
+	if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
+		return -EBUSY;
+	}
+
+	worker->queue = queue;
+	worker->cpu = MAX(cpu, -1);
+	sys_slist_init(&worker->pending);
+
+	(void)k_thread_create(&worker->thread, stack, stack_size,
+			      work_queue_main, queue, worker, NULL,
+			      k_thread_priority_get(&queue->thread), 0, K_FOREVER);
+
+#ifdef CONFIG_THREAD_NAME
+	k_thread_name_set(&worker->thread, queue->thread.name);
+#endif /* CONFIG_THREAD_NAME */
+
+	worker->thread.base.user_options |= queue->thread.base.user_options & K_ESSENTIAL;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (worker->cpu >= 0) {
+		(void)k_thread_cpu_pin(&worker->thread, worker->cpu);
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	sys_slist_append(&queue->workers, &worker->node);
+	queue->nr_threads++;
+
+	k_spin_unlock(&lock, key);
+
+	k_thread_start(&worker->thread);
+
+	return 0;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -780,7 +1164,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || queue_has_pending_locked(queue)) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -838,13 +1222,39 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
-	notify_queue_locked(queue);
+	/* Every thread of a pool has to see the request */
+	(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(&queue->thread, timeout)) {
-		key = k_spin_lock(&lock);
-		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
-		k_spin_unlock(&lock, key);
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* All threads of a pool must exit within the timeout */
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_work_q_worker *worker;
+	int ret = k_thread_join(&queue->thread, timeout);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (ret != 0) {
+			break;
+		}
+		ret = k_thread_join(&worker->thread, sys_timepoint_timeout(end));
+	}
+
+	/* Some threads of a pool may have exited already: rather than
+	 * running on with fewer threads, the pool keeps stopping.
+	 */
+	bool keep_stopping = queue_is_pool(queue);
+#else
+	int ret = k_thread_join(&queue->thread, timeout);
+	bool keep_stopping = false;
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	if (ret != 0) {
+		if (!keep_stopping) {
+			key = k_spin_lock(&lock);
+			flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
+			k_spin_unlock(&lock, key);
+		}
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, stop, queue, timeout, -ETIMEDOUT);
 		return -ETIMEDOUT;
 	}
@@ -1077,6 +1487,99 @@ int k_work_reschedule(struct k_work_delayable *dwork, k_timeout_t delay)
 	return ret;
 }
 
+/* Abort the timeouts of a batch of delayable work items.
+ *
+ * Invoked with work lock held.
+ *
+ * @param dworks the delayable work items
+ * @param count the number of items in @p dworks
+ */
+static void unschedule_batch_locked(struct k_work_delayable *const *dworks,
+				    size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		flag_clear(&dworks[i]->work.flags, K_WORK_DELAYED_BIT);
+	}
+
+	/* An item's timeout is only active while it's delayed, so the
+	 * timeouts of all items can be aborted in one go.
+	 */
+	z_abort_timeouts((void *const *)dworks, count,
+			 offsetof(struct k_work_delayable, timeout));
+}
+
+int k_work_reschedule_batch(struct k_work_q *queue,
+			    struct k_work_delayable *const *dworks,
+			    const k_timeout_t *delays, size_t count)
+{
+	__ASSERT_NO_MSG(queue != NULL);
+	__ASSERT_NO_MSG((dworks != NULL) && (delays != NULL));
+
+	sys_dlist_t batch;
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Remove any active scheduling. */
+	unschedule_batch_locked(dworks, count);
+
+	/* Schedule the work items with the new parameters, deferring the
+	 * timeouts to a single pass over the timeout queue.
+	 */
+	sys_dlist_init(&batch);
+	for (size_t i = 0; i < count; i++) {
+		struct k_work_delayable *dwork = dworks[i];
+		struct k_work_q *q = queue;
+
+		__ASSERT_NO_MSG(dwork != NULL);
+
+		if (K_TIMEOUT_EQ(delays[i], K_NO_WAIT)) {
+			if (submit_to_queue_locked(&dwork->work, &q) > 0) {
+				ret++;
+			}
+			continue;
+		}
+
+		flag_set(&dwork->work.flags, K_WORK_DELAYED_BIT);
+		dwork->queue = queue;
+		ret++;
+
+		if (!K_TIMEOUT_EQ(delays[i], K_FOREVER)) {
+			__ASSERT(!sys_dnode_is_linked(&dwork->timeout.node),
+				 "work item scheduled twice in a batch");
+			dwork->timeout.fn = work_timeout;
+			dwork->timeout.dticks = delays[i].ticks;
+			sys_dlist_append(&batch, &dwork->timeout.node);
+		}
+	}
+
+	z_add_timeouts(&batch);
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int k_work_cancel_delayable_batch(struct k_work_delayable *const *dworks,
+				  size_t count)
+{
+	__ASSERT_NO_MSG(dworks != NULL);
+
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	unschedule_batch_locked(dworks, count);
+
+	for (size_t i = 0; i < count; i++) {
+		if (cancel_async_locked(&dworks[i]->work) != 0) {
+			ret++;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
 int k_work_cancel_delayable(struct k_work_delayable *dwork)
 {
 	__ASSERT_NO_MSG(dwork != NULL);
@@ -1138,7 +1641,6 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work, flush_delayable, dwork, sync);
 
 	struct k_work *work = &dwork->work;
-	struct z_work_flusher *flusher = &sync->flusher;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	/* If it's idle release the lock and return immediately. */
@@ -1160,13 +1662,14 @@ bool k_work_flush_delayable(struct k_work_delayable *dwork,
 	}
 
 	/* Wait for it to finish */
-	bool need_flush = work_flush_locked(work, flusher);
+	struct k_sem *sem = work_flush_locked(work, sync);
+	bool need_flush = (sem != NULL);
 
 	k_spin_unlock(&lock, key);
 
 	/* If necessary wait until the flusher item completes */
 	if (need_flush) {
-		k_sem_take(&flusher->sem, K_FOREVER);
+		k_sem_take(sem, K_FOREVER);
 	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work, flush_delayable, dwork, sync, need_flush);
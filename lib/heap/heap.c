@@ -148,6 +148,93 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/*
+ * Small allocations are served from per-size free lists of chunks with
+ * exactly the requested size.  Those chunks are carved in batches out
+ * of one larger chunk, so objects of a given size end up packed
+ * together instead of splitting whatever free chunk happens to be
+ * found first, and freeing them simply pushes them back on their list.
+ * Chunks on these lists keep their "used" bit so that neighbours never
+ * merge with them; they are only returned to the general allocator
+ * when a list is full or when an allocation would otherwise fail.
+ * Their FREE_PREV field points to themselves, which tells them apart
+ * from allocated chunks when they are freed again.
+ */
+static void size_class_push(struct z_heap *h, struct z_heap_size_class *sc,
+			    chunkid_t c)
+{
+	set_prev_free_chunk(h, c, c);
+	set_next_free_chunk(h, c, sc->next);
+	sc->next = c;
+	sc->count++;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+}
+
+static chunkid_t size_class_pop(struct z_heap *h, struct z_heap_size_class *sc)
+{
+	chunkid_t c = sc->next;
+
+	CHECK(chunk_used(h, c));
+	sc->next = next_free_chunk(h, c);
+	sc->count--;
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+
+	return c;
+}
+
+/* Is chunk "c" on a size class list?  User data can make FREE_PREV point
+ * to the chunk itself by chance, so a match is confirmed by looking for
+ * the chunk on its list, which is short.
+ */
+static inline bool size_class_holds(struct z_heap *h, chunkid_t c)
+{
+	struct z_heap_size_class *sc = size_class(h, chunk_size(h, c));
+	chunkid_t n;
+
+	if ((sc == NULL) || (prev_free_chunk(h, c) != c)) {
+		return false;
+	}
+
+	n = sc->next;
+	for (uint32_t i = 0; i < sc->count; i++, n = next_free_chunk(h, n)) {
+		if (n == c) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Give every chunk held by the size classes back to the free lists.
+ * Returns false if there was nothing to give back.
+ */
+static bool size_class_flush(struct z_heap *h)
+{
+	bool flushed = false;
+
+	for (int i = 0; i < CONFIG_SYS_HEAP_SIZE_CLASS_COUNT; i++) {
+		struct z_heap_size_class *sc = &h->classes[i];
+
+		while (sc->count != 0U) {
+			chunkid_t c = size_class_pop(h, sc);
+
+			set_chunk_used(h, c, false);
+			free_chunk(h, c);
+			flushed = true;
+		}
+	}
+
+	return flushed;
+}
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+
 /*
  * Return the closest chunk ID corresponding to given memory pointer.
  * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
@@ -174,6 +261,10 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 	 */
 	__ASSERT(chunk_used(h, c),
 		 "unexpected heap state (double-free?) for memory at %p", mem);
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	__ASSERT(!size_class_holds(h, c),
+		 "unexpected heap state (double-free?) for memory at %p", mem);
+#endif
 
 	/*
 	 * It is easy to catch many common memory overflow cases with
@@ -184,7 +275,6 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 		 "corrupted heap bounds (buffer overflow?) for memory at %p",
 		 mem);
 
-	set_chunk_used(h, c, false);
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	h->allocated_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
 #endif
@@ -194,6 +284,16 @@ void sys_heap_free(struct sys_heap *heap, void *mem)
 				  chunksz_to_bytes(h, chunk_size(h, c)));
 #endif
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	struct z_heap_size_class *sc = size_class(h, chunk_size(h, c));
+
+	if ((sc != NULL) && (sc->count < CONFIG_SYS_HEAP_SIZE_CLASS_MAX_FREE)) {
+		size_class_push(h, sc, c);
+		return;
+	}
+#endif
+
+	set_chunk_used(h, c, false);
 	free_chunk(h, c);
 }
 
@@ -260,6 +360,62 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+static chunkid_t size_class_alloc(struct z_heap *h, chunksz_t sz)
+{
+	struct z_heap_size_class *sc = size_class(h, sz);
+	chunksz_t batch_sz = sz * CONFIG_SYS_HEAP_SIZE_CLASS_BATCH;
+	chunkid_t c;
+
+	if (sc == NULL) {
+		return 0;
+	}
+
+	if (sc->count != 0U) {
+		return size_class_pop(h, sc);
+	}
+
+	if ((CONFIG_SYS_HEAP_SIZE_CLASS_BATCH == 1) || (batch_sz >= h->end_chunk)) {
+		return 0;
+	}
+
+	/* Refill: carve a batch of chunks out of a single free chunk,
+	 * keep the first one and stash the others.
+	 */
+	c = alloc_chunk(h, batch_sz);
+	if (c == 0U) {
+		return 0;
+	}
+
+	if (chunk_size(h, c) > batch_sz) {
+		split_chunks(h, c, c + batch_sz);
+		free_list_add(h, c + batch_sz);
+	}
+
+	for (int i = CONFIG_SYS_HEAP_SIZE_CLASS_BATCH - 1; i > 0; i--) {
+		split_chunks(h, c, c + i * sz);
+		set_chunk_used(h, c + i * sz, true);
+		size_class_push(h, sc, c + i * sz);
+	}
+
+	return c;
+}
+#endif /* CONFIG_SYS_HEAP_SIZE_CLASSES */
+
+/* As alloc_chunk(), but reclaims the size class chunks before giving up */
+static chunkid_t alloc_chunk_reclaim(struct z_heap *h, chunksz_t sz)
+{
+	chunkid_t c = alloc_chunk(h, sz);
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	if ((c == 0U) && size_class_flush(h)) {
+		c = alloc_chunk(h, sz);
+	}
+#endif
+
+	return c;
+}
+
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
@@ -270,15 +426,23 @@ void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 	}
 
 	chunksz_t chunk_sz = bytes_to_chunksz(h, bytes);
-	chunkid_t c = alloc_chunk(h, chunk_sz);
+	chunkid_t c = 0;
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	c = size_class_alloc(h, chunk_sz);
+#endif
+
 	if (c == 0U) {
-		return NULL;
-	}
+		c = alloc_chunk_reclaim(h, chunk_sz);
+		if (c == 0U) {
+			return NULL;
+		}
 
-	/* Split off remainder if any */
-	if (chunk_size(h, c) > chunk_sz) {
-		split_chunks(h, c, c + chunk_sz);
-		free_list_add(h, c + chunk_sz);
+		/* Split off remainder if any */
+		if (chunk_size(h, c) > chunk_sz) {
+			split_chunks(h, c, c + chunk_sz);
+			free_list_add(h, c + chunk_sz);
+		}
 	}
 
 	set_chunk_used(h, c, true);
@@ -333,7 +497,7 @@ void *sys_heap_aligned_alloc(struct sys_heap *heap, size_t align, size_t bytes)
 	 * the extra allocations afterwards.
 	 */
 	chunksz_t padded_sz = bytes_to_chunksz(h, bytes + align - gap);
-	chunkid_t c0 = alloc_chunk(h, padded_sz);
+	chunkid_t c0 = alloc_chunk_reclaim(h, padded_sz);
 
 	if (c0 == 0) {
 		return NULL;
@@ -531,6 +695,13 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 		h->buckets[i].next = 0;
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	for (int i = 0; i < CONFIG_SYS_HEAP_SIZE_CLASS_COUNT; i++) {
+		h->classes[i].next = 0;
+		h->classes[i].count = 0;
+	}
+#endif
+
 	/* chunk containing our struct z_heap */
 	set_chunk_size(h, 0, chunk0_size);
 	set_left_chunk_size(h, 0, 0);
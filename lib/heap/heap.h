@@ -65,6 +65,15 @@ struct z_heap_bucket {
 	chunkid_t next;
 };
 
+/* Small chunks of one exact size kept aside by the size class front
+ * end.  They stay marked used in the chunk headers (so they never get
+ * merged) and are linked through their FREE_NEXT field.
+ */
+struct z_heap_size_class {
+	chunkid_t next;
+	uint32_t count;
+};
+
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
 	chunkid_t end_chunk;
@@ -73,6 +82,9 @@ struct z_heap {
 	size_t free_bytes;
 	size_t allocated_bytes;
 	size_t max_allocated_bytes;
+#endif
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	struct z_heap_size_class classes[CONFIG_SYS_HEAP_SIZE_CLASS_COUNT];
 #endif
 	struct z_heap_bucket buckets[0];
 };
@@ -253,6 +265,21 @@ static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 	return 31 - __builtin_clz(usable_sz);
 }
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+/* Returns the size class serving chunks of size "sz", or NULL */
+static inline struct z_heap_size_class *size_class(struct z_heap *h,
+						   chunksz_t sz)
+{
+	chunksz_t idx = sz - min_chunk_size(h);
+
+	if (idx >= CONFIG_SYS_HEAP_SIZE_CLASS_COUNT) {
+		return NULL;
+	}
+
+	return &h->classes[idx];
+}
+#endif
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
@@ -277,6 +304,17 @@ static inline void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			*free_bytes += chunksz_to_bytes(h, chunk_size(h, c));
 		}
 	}
+
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/* Chunks held by the size classes are free as far as users go */
+	for (int i = 0; i < CONFIG_SYS_HEAP_SIZE_CLASS_COUNT; i++) {
+		size_t bytes = chunksz_to_bytes(h, min_chunk_size(h) + i) *
+			       h->classes[i].count;
+
+		*alloc_bytes -= bytes;
+		*free_bytes += bytes;
+	}
+#endif
 }
 
 #endif /* ZEPHYR_INCLUDE_LIB_OS_HEAP_H_ */
@@ -43,6 +43,18 @@ static void heap_print_info(struct z_heap *h, bool dump_chunks)
 		}
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	printk("\n  size class    units    cached\n"
+	       "  ----------------------------\n");
+	for (i = 0; i < CONFIG_SYS_HEAP_SIZE_CLASS_COUNT; i++) {
+		if (h->classes[i].count != 0U) {
+			printk("%12zd %8d %9d\n",
+			       chunksz_to_bytes(h, min_chunk_size(h) + i),
+			       min_chunk_size(h) + i, h->classes[i].count);
+		}
+	}
+#endif
+
 	if (dump_chunks) {
 		printk("\nChunk dump:\n");
 		for (chunkid_t c = 0; ; c = right_chunk(h, c)) {
@@ -17,6 +17,7 @@ struct z_heap_stress_rec {
 	size_t nblocks;
 	size_t blocks_alloced;
 	size_t bytes_alloced;
+	size_t max_alloc_bytes;
 	uint32_t target_percent;
 };
 
@@ -80,14 +81,18 @@ static bool rand_alloc_choice(struct z_heap_stress_rec *sr)
  */
 static size_t rand_alloc_size(struct z_heap_stress_rec *sr)
 {
-	ARG_UNUSED(sr);
-
 	/* Min scale of 4 means that the half of the requests in the
 	 * smallest size have an average size of 8
 	 */
 	int scale = 4 + __builtin_clz(rand32());
+	size_t sz = rand32() & BIT_MASK(scale);
+
+	/* Small object workloads fold everything into 1..max bytes */
+	if (sr->max_alloc_bytes != 0U) {
+		sz = (sz % sr->max_alloc_bytes) + 1U;
+	}
 
-	return rand32() & BIT_MASK(scale);
+	return sz;
 }
 
 /* Returns the index of a randomly chosen block to free */
@@ -104,13 +109,13 @@ static size_t rand_free_choice(struct z_heap_stress_rec *sr)
  * scratch array is used to store temporary state and should be sized
  * about half as large as the heap itself. Returns true on success.
  */
-void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
-		     void (*free_fn)(void *arg, void *p),
-		     void *arg, size_t total_bytes,
-		     uint32_t op_count,
-		     void *scratch_mem, size_t scratch_bytes,
-		     int target_percent,
-		     struct z_heap_stress_result *result)
+static void heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
+			void (*free_fn)(void *arg, void *p),
+			void *arg, size_t total_bytes,
+			uint32_t op_count,
+			void *scratch_mem, size_t scratch_bytes,
+			int target_percent, size_t max_alloc_bytes,
+			struct z_heap_stress_result *result)
 {
 	struct z_heap_stress_rec sr = {
 	       .alloc_fn = alloc_fn,
@@ -119,6 +124,7 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 	       .total_bytes = total_bytes,
 	       .blocks = scratch_mem,
 	       .nblocks = scratch_bytes / sizeof(struct z_heap_stress_block),
+	       .max_alloc_bytes = max_alloc_bytes,
 	       .target_percent = target_percent,
 	};
 
@@ -127,27 +133,68 @@ void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
 	for (uint32_t i = 0; i < op_count; i++) {
 		if (rand_alloc_choice(&sr)) {
 			size_t sz = rand_alloc_size(&sr);
+			uint32_t start = k_cycle_get_32();
 			void *p = sr.alloc_fn(sr.arg, sz);
+			uint32_t cycles = k_cycle_get_32() - start;
 
 			result->total_allocs++;
+			result->accumulated_alloc_cycles += cycles;
+			result->max_alloc_cycles = MAX(result->max_alloc_cycles, cycles);
 			if (p != NULL) {
 				result->successful_allocs++;
 				sr.blocks[sr.blocks_alloced].ptr = p;
 				sr.blocks[sr.blocks_alloced].sz = sz;
 				sr.blocks_alloced++;
 				sr.bytes_alloced += sz;
+			} else {
+				result->accumulated_failed_in_use_bytes += sr.bytes_alloced;
 			}
 		} else {
 			int b = rand_free_choice(&sr);
 			void *p = sr.blocks[b].ptr;
 			size_t sz = sr.blocks[b].sz;
+			uint32_t start;
+			uint32_t cycles;
 
 			result->total_frees++;
 			sr.blocks[b] = sr.blocks[sr.blocks_alloced - 1];
 			sr.blocks_alloced--;
 			sr.bytes_alloced -= sz;
+
+			start = k_cycle_get_32();
 			sr.free_fn(sr.arg, p);
+			cycles = k_cycle_get_32() - start;
+
+			result->accumulated_free_cycles += cycles;
+			result->max_free_cycles = MAX(result->max_free_cycles, cycles);
 		}
 		result->accumulated_in_use_bytes += sr.bytes_alloced;
 	}
 }
+
+void sys_heap_stress(void *(*alloc_fn)(void *arg, size_t bytes),
+		     void (*free_fn)(void *arg, void *p),
+		     void *arg, size_t total_bytes,
+		     uint32_t op_count,
+		     void *scratch_mem, size_t scratch_bytes,
+		     int target_percent,
+		     struct z_heap_stress_result *result)
+{
+	heap_stress(alloc_fn, free_fn, arg, total_bytes, op_count,
+		    scratch_mem, scratch_bytes, target_percent, 0, result);
+}
+
+void sys_heap_stress_small(void *(*alloc_fn)(void *arg, size_t bytes),
+			   void (*free_fn)(void *arg, void *p),
+			   void *arg, size_t total_bytes,
+			   uint32_t op_count,
+			   void *scratch_mem, size_t scratch_bytes,
+			   int target_percent, size_t max_alloc_bytes,
+			   struct z_heap_stress_result *result)
+{
+	__ASSERT(max_alloc_bytes != 0U, "max_alloc_bytes must not be zero");
+
+	heap_stress(alloc_fn, free_fn, arg, total_bytes, op_count,
+		    scratch_mem, scratch_bytes, target_percent,
+		    max_alloc_bytes, result);
+}
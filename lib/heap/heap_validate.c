@@ -85,6 +85,26 @@ bool sys_heap_validate(struct sys_heap *heap)
 		return false;  /* Should have exactly consumed the buffer */
 	}
 
+#ifdef CONFIG_SYS_HEAP_SIZE_CLASSES
+	/*
+	 * Chunks held by the size classes must be in-use chunks of
+	 * exactly the class size, marked as held by pointing to
+	 * themselves, and there must be as many as counted.
+	 */
+	for (int i = 0; i < CONFIG_SYS_HEAP_SIZE_CLASS_COUNT; i++) {
+		uint32_t n = 0;
+
+		for (c = h->classes[i].next; n < h->classes[i].count;
+		     n++, c = next_free_chunk(h, c)) {
+			if (!valid_chunk(h, c) || !chunk_used(h, c) ||
+			    (chunk_size(h, c) != min_chunk_size(h) + i) ||
+			    (prev_free_chunk(h, c) != c)) {
+				return false;
+			}
+		}
+	}
+#endif
+
 #ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
 	/*
 	 * Validate sys_heap_runtime_stats_get API.
@@ -8,6 +8,7 @@
 #include <zephyr/sys/mutex.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
+#include <kernel_internal.h>
 
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
@@ -23,9 +24,10 @@ static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 
 static bool check_sys_mutex_addr(struct sys_mutex *addr)
 {
-	/* sys_mutex memory is never touched, just used to lookup the
-	 * underlying k_mutex, but we don't want threads using mutexes
-	 * that are outside their memory domain
+	/* sys_mutex memory is used to lookup the underlying k_mutex and,
+	 * with CONFIG_SYS_MUTEX_FUTEX, holds the owner that the kernel
+	 * updates, so we don't want threads using mutexes that are outside
+	 * their memory domain
 	 */
 	return K_SYSCALL_MEMORY_WRITE(addr, sizeof(struct sys_mutex));
 }
@@ -38,7 +40,11 @@ int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	return z_mutex_futex_lock(kernel_mutex, &mutex->val, timeout);
+#else
 	return k_mutex_lock(kernel_mutex, timeout);
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
@@ -56,11 +62,19 @@ int z_impl_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
 
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	if (kernel_mutex == NULL) {
+		return -EINVAL;
+	}
+
+	return z_mutex_futex_unlock(kernel_mutex, &mutex->val);
+#else
 	if ((kernel_mutex == NULL) || (kernel_mutex->lock_count == 0)) {
 		return -EINVAL;
 	}
 
 	return k_mutex_unlock(kernel_mutex);
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
@@ -13,13 +13,19 @@
 #include <zephyr/sys/bitarray.h>
 #include <zephyr/sys/sem.h>
 
+#include <string.h>
+
 #define CONCURRENT_READER_LIMIT  (CONFIG_POSIX_THREAD_THREADS_MAX + 1)
 
+/* A thread holding the lock for reading, and how many times it took it */
+struct posix_rwlock_reader {
+	k_tid_t thread;
+	uint32_t count;
+};
+
 struct posix_rwlock {
-	struct sys_sem rd_sem;
-	struct sys_sem wr_sem;
-	struct sys_sem reader_active; /* blocks WR till reader has acquired lock */
-	k_tid_t wr_owner;
+	struct k_rwlock lock;
+	struct posix_rwlock_reader readers[CONCURRENT_READER_LIMIT];
 };
 
 struct posix_rwlockattr {
@@ -28,13 +34,18 @@ struct posix_rwlockattr {
 };
 
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
-static uint32_t read_lock_acquire(struct posix_rwlock *rwl, int32_t timeout);
-static uint32_t write_lock_acquire(struct posix_rwlock *rwl, int32_t timeout);
+static struct posix_rwlock_reader *find_reader(struct posix_rwlock *rwl,
+					       k_tid_t thread);
+static int read_lock_acquire(struct posix_rwlock *rwl, int32_t timeout);
+static int write_lock_acquire(struct posix_rwlock *rwl, int32_t timeout);
 
 LOG_MODULE_REGISTER(pthread_rwlock, CONFIG_PTHREAD_RWLOCK_LOG_LEVEL);
 
 static SYS_SEM_DEFINE(posix_rwlock_lock, 1, 1);
 
+/* Protects the reader records of all the rwlocks */
+static struct k_spinlock posix_rwlock_readers_lock;
+
 static struct posix_rwlock posix_rwlock_pool[CONFIG_MAX_PTHREAD_RWLOCK_COUNT];
 SYS_BITARRAY_DEFINE_STATIC(posix_rwlock_bitarray, CONFIG_MAX_PTHREAD_RWLOCK_COUNT);
 
@@ -124,10 +135,8 @@ int pthread_rwlock_init(pthread_rwlock_t *rwlock,
 		return ENOMEM;
 	}
 
-	sys_sem_init(&rwl->rd_sem, CONCURRENT_READER_LIMIT, CONCURRENT_READER_LIMIT);
-	sys_sem_init(&rwl->wr_sem, 1, 1);
-	sys_sem_init(&rwl->reader_active, 1, 1);
-	rwl->wr_owner = NULL;
+	(void)k_rwlock_init(&rwl->lock);
+	memset(rwl->readers, 0, sizeof(rwl->readers));
 
 	LOG_DBG("Initialized rwlock %p", rwl);
 
@@ -153,7 +162,7 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 			SYS_SEM_LOCK_BREAK;
 		}
 
-		if (rwl->wr_owner != NULL) {
+		if ((rwl->lock.writer != NULL) || (rwl->lock.readers != 0U)) {
 			ret = EBUSY;
 			SYS_SEM_LOCK_BREAK;
 		}
@@ -170,8 +179,8 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for reading.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * New readers wait while a writer holds or waits for the lock. A thread that
+ * already holds the lock for reading takes it again without waiting.
  *
  * See IEEE 1003.1
  */
@@ -190,8 +199,8 @@ int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for reading within specific time.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * New readers wait while a writer holds or waits for the lock. A thread that
+ * already holds the lock for reading takes it again without waiting.
  *
  * See IEEE 1003.1
  */
@@ -199,7 +208,7 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 			       const struct timespec *abstime)
 {
 	int32_t timeout;
-	uint32_t ret = 0U;
+	int ret = 0;
 	struct posix_rwlock *rwl;
 
 	if (abstime->tv_nsec < 0 || abstime->tv_nsec > NSEC_PER_SEC) {
@@ -213,7 +222,8 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 		return EINVAL;
 	}
 
-	if (read_lock_acquire(rwl, timeout) != 0U) {
+	ret = read_lock_acquire(rwl, timeout);
+	if (ret == EBUSY) {
 		ret = ETIMEDOUT;
 	}
 
@@ -223,8 +233,8 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 /**
  * @brief Lock a read-write lock object for reading immediately.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
+ * New readers wait while a writer holds or waits for the lock. A thread that
+ * already holds the lock for reading takes it again without waiting.
  *
  * See IEEE 1003.1
  */
@@ -243,8 +253,8 @@ int pthread_rwlock_tryrdlock(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for writing.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Writers have priority over readers: once a writer waits for the lock, new
+ * readers wait behind it.
  *
  * See IEEE 1003.1
  */
@@ -263,8 +273,8 @@ int pthread_rwlock_wrlock(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for writing within specific time.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Writers have priority over readers: once a writer waits for the lock, new
+ * readers wait behind it.
  *
  * See IEEE 1003.1
  */
@@ -272,7 +282,7 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 			       const struct timespec *abstime)
 {
 	int32_t timeout;
-	uint32_t ret = 0U;
+	int ret = 0;
 	struct posix_rwlock *rwl;
 
 	if (abstime->tv_nsec < 0 || abstime->tv_nsec > NSEC_PER_SEC) {
@@ -286,7 +296,8 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 		return EINVAL;
 	}
 
-	if (write_lock_acquire(rwl, timeout) != 0U) {
+	ret = write_lock_acquire(rwl, timeout);
+	if (ret == EBUSY) {
 		ret = ETIMEDOUT;
 	}
 
@@ -296,8 +307,8 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 /**
  * @brief Lock a read-write lock object for writing immediately.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Writers have priority over readers: once a writer waits for the lock, new
+ * readers wait behind it.
  *
  * See IEEE 1003.1
  */
@@ -321,76 +332,119 @@ int pthread_rwlock_trywrlock(pthread_rwlock_t *rwlock)
  */
 int pthread_rwlock_unlock(pthread_rwlock_t *rwlock)
 {
+	struct posix_rwlock_reader *reader;
 	struct posix_rwlock *rwl;
+	bool read_unlock = false;
+	int ret = 0;
 
 	rwl = get_posix_rwlock(*rwlock);
 	if (rwl == NULL) {
 		return EINVAL;
 	}
 
-	if (k_current_get() == rwl->wr_owner) {
-		/* Write unlock */
-		rwl->wr_owner = NULL;
-		(void)sys_sem_give(&rwl->reader_active);
-		(void)sys_sem_give(&rwl->wr_sem);
-	} else {
-		/* Read unlock */
-		(void)sys_sem_give(&rwl->rd_sem);
+	/* Only the current thread can make itself the writer or stop being
+	 * it, so this does not race with other threads.
+	 */
+	if (k_current_get() == rwl->lock.writer) {
+		(void)k_rwlock_write_unlock(&rwl->lock);
+		return 0;
+	}
+
+	K_SPINLOCK(&posix_rwlock_readers_lock) {
+		reader = find_reader(rwl, k_current_get());
+		if (reader == NULL) {
+			/* Neither the writer nor a reader */
+			ret = EPERM;
+			K_SPINLOCK_BREAK;
+		}
 
-		if (sys_sem_count_get(&rwl->rd_sem) == CONCURRENT_READER_LIMIT) {
-			/* Last read lock, unlock writer */
-			(void)sys_sem_give(&rwl->reader_active);
+		if (--reader->count == 0U) {
+			reader->thread = NULL;
+			read_unlock = true;
 		}
 	}
-	return 0;
+
+	if (read_unlock) {
+		(void)k_rwlock_read_unlock(&rwl->lock);
+	}
+
+	return ret;
 }
 
-static uint32_t read_lock_acquire(struct posix_rwlock *rwl, int32_t timeout)
+static int rwlock_errno(int err)
 {
-	uint32_t ret = 0U;
+	switch (err) {
+	case 0:
+		return 0;
+	case -EDEADLK:
+		return EDEADLK;
+	default:
+		/* -EBUSY or -EAGAIN */
+		return EBUSY;
+	}
+}
 
-	if (sys_sem_take(&rwl->wr_sem, SYS_TIMEOUT_MS(timeout)) == 0) {
-		(void)sys_sem_take(&rwl->reader_active, K_NO_WAIT);
-		(void)sys_sem_take(&rwl->rd_sem, K_NO_WAIT);
-		(void)sys_sem_give(&rwl->wr_sem);
-	} else {
-		ret = EBUSY;
+/* Must be called with posix_rwlock_readers_lock held */
+static struct posix_rwlock_reader *find_reader(struct posix_rwlock *rwl,
+					       k_tid_t thread)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(rwl->readers); i++) {
+		if (rwl->readers[i].thread == thread) {
+			return &rwl->readers[i];
+		}
 	}
 
-	return ret;
+	return NULL;
 }
 
-static uint32_t write_lock_acquire(struct posix_rwlock *rwl, int32_t timeout)
+static int read_lock_acquire(struct posix_rwlock *rwl, int32_t timeout)
 {
-	uint32_t ret = 0U;
-	int64_t elapsed_time, st_time = k_uptime_get();
-	k_timeout_t k_timeout;
-
-	k_timeout = SYS_TIMEOUT_MS(timeout);
-
-	/* waiting for release of write lock */
-	if (sys_sem_take(&rwl->wr_sem, k_timeout) == 0) {
-		/* update remaining timeout time for 2nd sem */
-		if (timeout != SYS_FOREVER_MS) {
-			elapsed_time = k_uptime_get() - st_time;
-			timeout = timeout <= elapsed_time ? 0 :
-				  timeout - elapsed_time;
+	struct posix_rwlock_reader *reader;
+	bool held = false;
+	int ret;
+
+	/*
+	 * The k_rwlock makes new readers wait behind waiting writers, which
+	 * would deadlock a thread that already holds the lock for reading.
+	 * Such a thread only counts one more hold instead.
+	 */
+	K_SPINLOCK(&posix_rwlock_readers_lock) {
+		reader = find_reader(rwl, k_current_get());
+		if (reader != NULL) {
+			reader->count++;
+			held = true;
 		}
+	}
 
-		k_timeout = SYS_TIMEOUT_MS(timeout);
+	if (held) {
+		return 0;
+	}
 
-		/* waiting for reader to complete operation */
-		if (sys_sem_take(&rwl->reader_active, k_timeout) == 0) {
-			rwl->wr_owner = k_current_get();
-		} else {
-			(void)sys_sem_give(&rwl->wr_sem);
-			ret = EBUSY;
+	ret = rwlock_errno(k_rwlock_read_lock(&rwl->lock, SYS_TIMEOUT_MS(timeout)));
+	if (ret != 0) {
+		return ret;
+	}
+
+	K_SPINLOCK(&posix_rwlock_readers_lock) {
+		reader = find_reader(rwl, NULL);
+		if (reader != NULL) {
+			reader->thread = k_current_get();
+			reader->count = 1U;
 		}
+	}
 
-	} else {
-		ret = EBUSY;
+	if (reader == NULL) {
+		/* Too many threads hold the lock for reading */
+		(void)k_rwlock_read_unlock(&rwl->lock);
+		return EAGAIN;
 	}
-	return ret;
+
+	return 0;
+}
+
+static int write_lock_acquire(struct posix_rwlock *rwl, int32_t timeout)
+{
+	return rwlock_errno(k_rwlock_write_lock(&rwl->lock, SYS_TIMEOUT_MS(timeout)));
 }
 
 int pthread_rwlockattr_getpshared(const pthread_rwlockattr_t *ZRESTRICT attr,
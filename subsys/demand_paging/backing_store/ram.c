@@ -124,6 +124,18 @@ void k_mem_paging_backing_store_page_in(uintptr_t location)
 		     CONFIG_MMU_PAGE_SIZE);
 }
 
+void k_mem_paging_backing_store_page_in_batch(const uintptr_t *locations,
+					      size_t count)
+{
+	char *dst = K_MEM_SCRATCH_AREA;
+
+	for (size_t i = 0; i < count; i++) {
+		(void)memcpy(dst, location_to_slab(locations[i]),
+			     CONFIG_MMU_PAGE_SIZE);
+		dst += CONFIG_MMU_PAGE_SIZE;
+	}
+}
+
 void k_mem_paging_backing_store_page_finalize(struct k_mem_page_frame *pf,
 					      uintptr_t location)
 {
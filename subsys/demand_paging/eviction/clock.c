@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CLOCK (second chance) eviction algorithm for demand paging, with an
+ * optional working set variant based on page aging.
+ *
+ * Theory of Operation:
+ *
+ * - Page frames are laid out in a circle in k_mem_page_frames[] order, and
+ *   a clock hand points at the next page frame to consider for eviction.
+ *
+ * - On page reclamation, the hand sweeps forward over the evictable page
+ *   frames. A page accessed since the hand last went by gets a second
+ *   chance: its accessed flag is cleared and the hand moves on. The first
+ *   page found not accessed is evicted and the hand stops right past it.
+ *
+ * - Once the hand went all the way around, all accessed flags are cleared,
+ *   so it never sweeps more than twice. Since each second chance consumes
+ *   an access, selection is O(1) amortized over accesses, and unlike NRU
+ *   there is no periodic scan of all page frames.
+ *
+ * With CONFIG_EVICTION_CLOCK_AGING, a periodic timer instead records whether
+ * each page was accessed during the last period in an age byte, shifting the
+ * older periods down. Pages not accessed during the last 8 periods are out
+ * of the working set: the hand evicts the first such page it finds, or else
+ * the page with the oldest accesses, clean pages first, after one sweep.
+ */
+
+#include <limits.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm/demand_paging.h>
+#include <zephyr/spinlock.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* Index of the next page frame the hand considers */
+static uint32_t clock_hand;
+
+static inline uintptr_t clock_page_flags(struct k_mem_page_frame *pf,
+					 bool clear_accessed)
+{
+	uintptr_t flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL,
+					     clear_accessed);
+
+	/* Implies a mismatch with page frame ontology and page tables */
+	__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+		 "non-present page, %s",
+		 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+		 "un-mapped" : "paged out");
+
+	return flags;
+}
+
+#ifdef CONFIG_EVICTION_CLOCK_AGING
+
+/* Access history of each page frame, the last period in the top bit */
+static uint8_t clock_ages[K_MEM_NUM_PAGE_FRAMES];
+static struct k_spinlock clock_lock;
+
+#define AGE_ACCESSED	BIT(7)
+
+static void clock_aging_update(struct k_timer *timer)
+{
+	uintptr_t phys;
+	struct k_mem_page_frame *pf;
+	k_spinlock_key_t key = k_spin_lock(&clock_lock);
+
+	ARG_UNUSED(timer);
+
+	K_MEM_PAGE_FRAME_FOREACH(phys, pf) {
+		uint8_t *age = &clock_ages[pf - k_mem_page_frames];
+		uintptr_t flags;
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			*age = 0U;
+			continue;
+		}
+
+		/* Clear accessed bit in page tables */
+		flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL,
+					   true);
+		*age >>= 1;
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+			*age |= AGE_ACCESSED;
+		}
+	}
+
+	k_spin_unlock(&clock_lock, key);
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct k_mem_page_frame *pf = NULL;
+	unsigned int last_rank = UINT_MAX;
+	uint32_t last_idx = 0U;
+	bool dirty = false;
+	uint32_t scanned = 0U;
+	k_spinlock_key_t key = k_spin_lock(&clock_lock);
+
+	while (scanned < K_MEM_NUM_PAGE_FRAMES) {
+		uint32_t idx = clock_hand;
+		struct k_mem_page_frame *candidate = &k_mem_page_frames[idx];
+		uintptr_t flags;
+		unsigned int rank;
+
+		clock_hand = (clock_hand + 1U) % K_MEM_NUM_PAGE_FRAMES;
+		scanned++;
+
+		if (!k_mem_page_frame_is_evictable(candidate)) {
+			continue;
+		}
+
+		/* Pages accessed during the current period rank highest, then
+		 * pages by age, and dirty pages above clean ones of the same age
+		 */
+		flags = clock_page_flags(candidate, false);
+		rank = ((unsigned int)clock_ages[idx] << 1) |
+		       (((flags & ARCH_DATA_PAGE_DIRTY) != 0U) ? 1U : 0U);
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+			rank |= AGE_ACCESSED << 2;
+		}
+
+		if (rank < last_rank) {
+			last_rank = rank;
+			last_idx = idx;
+			pf = candidate;
+			dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0U;
+		}
+
+		if (rank <= 1U) {
+			/* Out of the working set, we're done */
+			break;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(pf != NULL, "no page to evict");
+
+	/* The next sweep starts past the evicted page, whose history is over */
+	clock_hand = (last_idx + 1U) % K_MEM_NUM_PAGE_FRAMES;
+	clock_ages[last_idx] = 0U;
+	k_spin_unlock(&clock_lock, key);
+
+	k_mem_paging_stats_eviction_scanned(scanned);
+	*dirty_ptr = dirty;
+
+	return pf;
+}
+
+static K_TIMER_DEFINE(clock_aging_timer, clock_aging_update, NULL);
+
+void k_mem_paging_eviction_init(void)
+{
+	k_timer_start(&clock_aging_timer, K_MSEC(CONFIG_EVICTION_CLOCK_AGING_PERIOD),
+		      K_MSEC(CONFIG_EVICTION_CLOCK_AGING_PERIOD));
+}
+
+#else
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct k_mem_page_frame *pf = NULL;
+	uintptr_t flags = 0U;
+	uint32_t scanned = 0U;
+
+	/* The first sweep clears all the accessed flags, so the second one
+	 * is bound to find a page
+	 */
+	while (scanned < (2U * K_MEM_NUM_PAGE_FRAMES)) {
+		struct k_mem_page_frame *candidate = &k_mem_page_frames[clock_hand];
+
+		clock_hand = (clock_hand + 1U) % K_MEM_NUM_PAGE_FRAMES;
+		scanned++;
+
+		if (!k_mem_page_frame_is_evictable(candidate)) {
+			continue;
+		}
+
+		/* Clearing the accessed flag gives the page its second chance */
+		flags = clock_page_flags(candidate, true);
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) == 0U) {
+			pf = candidate;
+			break;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(pf != NULL, "no page to evict");
+
+	k_mem_paging_stats_eviction_scanned(scanned);
+	*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0U;
+
+	return pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
+
+#endif /* CONFIG_EVICTION_CLOCK_AGING */
+
+#ifdef CONFIG_EVICTION_TRACKING
+/*
+ * The hand finds evictable page frames by itself. These are defined here
+ * so that architectures unconditionally implementing eviction tracking can
+ * still use this algorithm.
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+#ifdef CONFIG_EVICTION_CLOCK_AGING
+	/* A new data page starts with no history */
+	clock_ages[pf - k_mem_page_frames] = 0U;
+#else
+	ARG_UNUSED(pf);
+#endif /* CONFIG_EVICTION_CLOCK_AGING */
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+#endif /* CONFIG_EVICTION_TRACKING */
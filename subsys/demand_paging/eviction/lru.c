@@ -171,6 +171,7 @@ struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	uintptr_t flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false);
 
 	__ASSERT(k_mem_page_frame_is_evictable(pf), "");
+	k_mem_paging_stats_eviction_scanned(1U);
 	*dirty_ptr = ((flags & ARCH_DATA_PAGE_DIRTY) != 0);
 	return pf;
 }
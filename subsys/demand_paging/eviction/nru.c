@@ -52,6 +52,7 @@ struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	bool dirty = false;
 	uintptr_t flags;
 	uint32_t pf_idx;
+	uint32_t scanned = 0U;
 	static uint32_t last_pf_idx;
 
 	/* similar to K_MEM_PAGE_FRAME_FOREACH except we don't always start at 0 */
@@ -60,6 +61,7 @@ struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	do {
 		pf = &k_mem_page_frames[pf_idx];
 		pf_idx = (pf_idx + 1) % ARRAY_SIZE(k_mem_page_frames);
+		scanned++;
 
 		unsigned int prec;
 
@@ -98,6 +100,7 @@ struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	__ASSERT(last_pf != NULL, "no page to evict");
 
 	last_pf_idx = last_pf - k_mem_page_frames;
+	k_mem_paging_stats_eviction_scanned(scanned);
 	*dirty_ptr = last_dirty;
 
 	return last_pf;
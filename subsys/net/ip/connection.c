@@ -64,6 +64,20 @@ static struct net_conn conns[CONFIG_NET_MAX_CONN];
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+#if defined(CONFIG_NET_CONN_PORT_HASH_BITS)
+#define CONN_PORT_HASH_SIZE BIT(CONFIG_NET_CONN_PORT_HASH_BITS)
+#else
+#define CONN_PORT_HASH_SIZE 1
+#endif
+
+/* IP connections are also indexed by local port, the ones bound to a port
+ * in conn_port_hash and the others in conn_any_port. Like conn_used, these
+ * lists have the newest connections first.
+ */
+static sys_slist_t conn_port_hash[CONN_PORT_HASH_SIZE];
+static sys_slist_t conn_any_port;
+static uint32_t conn_seq;
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -135,15 +149,91 @@ static struct net_conn *conn_get_unused(void)
 	return CONTAINER_OF(node, struct net_conn, node);
 }
 
+static bool conn_is_ip(uint8_t family)
+{
+	return family == AF_INET || family == AF_INET6 || family == AF_UNSPEC;
+}
+
+/* Port in network byte order */
+static sys_slist_t *conn_port_list(uint16_t port)
+{
+	if (port == 0U) {
+		return &conn_any_port;
+	}
+
+	/* Spread sequential ports over the buckets */
+	port = ntohs(port);
+
+	return &conn_port_hash[(port ^ (port >> 8)) & (CONN_PORT_HASH_SIZE - 1U)];
+}
+
 static void conn_set_used(struct net_conn *conn)
 {
 	conn->flags |= NET_CONN_IN_USE;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn->seq = conn_seq++;
 	sys_slist_prepend(&conn_used, &conn->node);
+
+	if (conn_is_ip(conn->family)) {
+		sys_slist_prepend(conn_port_list(net_sin(&conn->local_addr)->sin_port),
+				  &conn->port_node);
+	}
+
 	k_mutex_unlock(&conn_lock);
 }
 
+/* Is conn registered after other */
+static inline bool conn_is_newer(const struct net_conn *conn,
+				 const struct net_conn *other)
+{
+	return (int32_t)(conn->seq - other->seq) > 0;
+}
+
+/* Iterator over the connections that might be bound to a local port, as
+ * far as the port index tells. Each list has the newest connections first.
+ */
+struct conn_candidates {
+	sys_snode_t *node;
+	sys_slist_t *any_port;
+	bool indexed;
+};
+
+/* Must be called with conn_lock held. Port in network byte order */
+static void conn_candidates_init(struct conn_candidates *it, uint8_t family,
+				 uint16_t local_port)
+{
+	if (IS_ENABLED(CONFIG_NET_IP) && (family == AF_INET || family == AF_INET6)) {
+		/* Connections bound to the port, then the ones bound to none */
+		it->node = sys_slist_peek_head(conn_port_list(local_port));
+		it->any_port = (local_port != 0U) ? &conn_any_port : NULL;
+		it->indexed = true;
+	} else {
+		it->node = sys_slist_peek_head(&conn_used);
+		it->any_port = NULL;
+		it->indexed = false;
+	}
+}
+
+static struct net_conn *conn_candidates_next(struct conn_candidates *it)
+{
+	sys_snode_t *node = it->node;
+
+	if (node == NULL && it->any_port != NULL) {
+		node = sys_slist_peek_head(it->any_port);
+		it->any_port = NULL;
+	}
+
+	if (node == NULL) {
+		return NULL;
+	}
+
+	it->node = sys_slist_peek_next(node);
+
+	return it->indexed ? CONTAINER_OF(node, struct net_conn, port_node) :
+			     CONTAINER_OF(node, struct net_conn, node);
+}
+
 static void conn_set_unused(struct net_conn *conn)
 {
 	(void)memset(conn, 0, sizeof(*conn));
@@ -162,12 +252,16 @@ static struct net_conn *conn_find_handler(struct net_if *iface,
 					  uint16_t local_port,
 					  bool reuseport_set)
 {
+	struct conn_candidates candidates;
 	struct net_conn *conn;
-	struct net_conn *tmp;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
+	/* An identical handler is bound to the same local port */
+	conn_candidates_init(&candidates, family, htons(local_port));
+	candidates.any_port = NULL;
+
+	while ((conn = conn_candidates_next(&candidates)) != NULL) {
 		if (conn->proto != proto) {
 			continue;
 		}
@@ -452,6 +546,12 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+
+	if (conn_is_ip(conn->family)) {
+		sys_slist_find_and_remove(conn_port_list(net_sin(&conn->local_addr)->sin_port),
+					  &conn->port_node);
+	}
+
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -681,6 +781,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		ntohs(src_port), ntohs(dst_port), net_pkt_family(pkt));
 
 
+	struct conn_candidates candidates;
 	struct net_conn *best_match = NULL;
 	int16_t best_rank = -1;
 	bool is_mcast_pkt = false;
@@ -710,7 +811,12 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+	/* Only the connections bound to the destination port, or to none,
+	 * can match TCP/UDP packets. The others are still checked in order.
+	 */
+	conn_candidates_init(&candidates, pkt_family, dst_port);
+
+	while ((conn = conn_candidates_next(&candidates)) != NULL) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
 		    net_context_is_bound_to_iface(conn->context) &&
@@ -837,7 +943,12 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 				 */
 			}
 
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
+			/* Of equally ranked connections, the newest one gets
+			 * the packet, whichever list it was found in.
+			 */
+			if (best_rank < NET_CONN_RANK(conn->flags) ||
+			    (best_rank == NET_CONN_RANK(conn->flags) &&
+			     conn_is_newer(conn, best_match))) {
 				struct net_pkt *mcast_pkt;
 
 				if (!is_mcast_pkt) {
@@ -964,6 +1075,11 @@ void net_conn_init(void)
 
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
+	sys_slist_init(&conn_any_port);
+
+	for (i = 0; i < CONN_PORT_HASH_SIZE; i++) {
+		sys_slist_init(&conn_port_hash[i]);
+	}
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
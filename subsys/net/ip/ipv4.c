@@ -476,6 +476,13 @@ enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
 	}
 
 #if defined(CONFIG_NET_IPV4_FRAGMENT)
+	/* TCP super-segments are split into segments that fit the MTU
+	 * before they reach L2, they must not be fragmented.
+	 */
+	if (net_pkt_gso_size(pkt) > 0U) {
+		return NET_OK;
+	}
+
 	return net_ipv4_prepare_for_send_fragment(pkt);
 #else
 	return NET_OK;
@@ -35,6 +35,7 @@ LOG_MODULE_REGISTER(net_if, CONFIG_NET_IF_LOG_LEVEL);
 #include "net_private.h"
 #include "ipv4.h"
 #include "ipv6.h"
+#include "tcp_internal.h"
 
 #include "net_stats.h"
 
@@ -213,6 +214,25 @@ static void update_txtime_stats_detail(struct net_pkt *pkt,
 	}
 }
 
+/* TCP super-segments are split right before L2, unless the Ethernet
+ * device does the segmentation itself.
+ */
+static bool need_tcp_segmentation(struct net_if *iface, struct net_pkt *pkt)
+{
+	if (net_pkt_gso_size(pkt) == 0U) {
+		return false;
+	}
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET) &&
+	    (net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO)) {
+		return false;
+	}
+#endif
+
+	return true;
+}
+
 static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct net_linkaddr ll_dst = {
@@ -264,7 +284,12 @@ static bool net_if_tx(struct net_if *iface, struct net_pkt *pkt)
 		}
 
 		net_if_tx_lock(iface);
-		status = net_if_l2(iface)->send(iface, pkt);
+		if (IS_ENABLED(CONFIG_NET_TCP_GSO) &&
+		    need_tcp_segmentation(iface, pkt)) {
+			status = net_tcp_gso_send(iface, pkt);
+		} else {
+			status = net_if_l2(iface)->send(iface, pkt);
+		}
 		net_if_tx_unlock(iface);
 
 		if (IS_ENABLED(CONFIG_NET_PKT_TXTIME_STATS) ||
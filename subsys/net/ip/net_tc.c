@@ -17,6 +17,7 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "tcp_internal.h"
 
 #define TC_RX_PSEUDO_QUEUE (COND_CODE_1(CONFIG_NET_TC_RX_SKIP_FOR_HIGH_PRIO, (1), (0)))
 #define NET_TC_RX_EFFECTIVE_COUNT (NET_TC_RX_COUNT + TC_RX_PSEUDO_QUEUE)
@@ -102,6 +103,19 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 }
 
+bool net_tc_is_rx_thread(void)
+{
+#if NET_TC_RX_COUNT > 0
+	for (int i = 0; i < NET_TC_RX_COUNT; i++) {
+		if (k_current_get() == &rx_classes[i].handler) {
+			return true;
+		}
+	}
+#endif
+
+	return false;
+}
+
 int net_tx_priority2tc(enum net_priority prio)
 {
 #if NET_TC_TX_COUNT > 0
@@ -293,6 +307,13 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 #endif
 
 		net_process_rx_packet(pkt);
+
+		/* TCP holds back in-order segments to coalesce them, let it
+		 * process them once the burst of received packets is over.
+		 */
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO) && k_fifo_is_empty(fifo)) {
+			net_tcp_gro_flush();
+		}
 	}
 }
 #endif
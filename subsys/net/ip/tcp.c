@@ -32,7 +32,8 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #define LAST_ACK_TIMEOUT_MS tcp_max_timeout_ms
 #define LAST_ACK_TIMEOUT K_MSEC(LAST_ACK_TIMEOUT_MS)
 #define FIN_TIMEOUT K_MSEC(tcp_max_timeout_ms)
-#define ACK_DELAY K_MSEC(100)
+#define ACK_DELAY_MS 100
+#define ACK_DELAY K_MSEC(ACK_DELAY_MS)
 #define ZWP_MAX_DELAY_MS 120000
 #define DUPLICATE_ACK_RETRANSMIT_TRHESHOLD 3
 
@@ -71,6 +72,14 @@ static int tcp_tx_window =
 
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
+#define TCP_CONN_HASH_SIZE BIT(CONFIG_NET_TCP_CONN_HASH_BITS)
+
+/* Connections with both endpoints set, hashed on them for tcp_conn_search().
+ * The hash is seeded at boot so that peers cannot pick colliding endpoints.
+ */
+static sys_slist_t tcp_conns_hash[TCP_CONN_HASH_SIZE];
+static uint32_t tcp_conns_hash_seed;
+
 static K_MUTEX_DEFINE(tcp_lock);
 
 K_MEM_SLAB_DEFINE_STATIC(tcp_conns_slab, sizeof(struct tcp),
@@ -240,6 +249,56 @@ static int tcp_endpoint_set(union tcp_endpoint *ep, struct net_pkt *pkt,
 	return ret;
 }
 
+static inline uint32_t tcp_hash_mix(uint32_t hash, uint32_t val)
+{
+	hash = (hash ^ val) * 0x9e3779b1U;
+
+	return hash ^ (hash >> 15);
+}
+
+static uint32_t tcp_endpoint_hash(const union tcp_endpoint *ep, uint32_t hash)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && ep->sa.sa_family == AF_INET6) {
+		for (size_t i = 0; i < ARRAY_SIZE(ep->sin6.sin6_addr.s6_addr32); i++) {
+			hash = tcp_hash_mix(hash, ep->sin6.sin6_addr.s6_addr32[i]);
+		}
+
+		return tcp_hash_mix(hash, ep->sin6.sin6_port);
+	}
+
+	hash = tcp_hash_mix(hash, ep->sin.sin_addr.s_addr);
+
+	return tcp_hash_mix(hash, ep->sin.sin_port);
+}
+
+/* Bucket of the connection from the local src to the remote dst endpoint */
+static sys_slist_t *tcp_conn_bucket(const union tcp_endpoint *src,
+				    const union tcp_endpoint *dst)
+{
+	uint32_t hash = tcp_conns_hash_seed;
+
+	hash = tcp_endpoint_hash(src, hash);
+	hash = tcp_endpoint_hash(dst, hash);
+
+	return &tcp_conns_hash[hash & (TCP_CONN_HASH_SIZE - 1U)];
+}
+
+/* Make a connection visible to tcp_conn_search() once its endpoints are set */
+static void tcp_conn_hash_add(struct tcp *conn)
+{
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+	sys_slist_append(tcp_conn_bucket(&conn->src, &conn->dst),
+			 &conn->hash_next);
+	k_mutex_unlock(&tcp_lock);
+}
+
+/* Must be called with tcp_lock held, before changing the endpoints */
+static void tcp_conn_hash_remove(struct tcp *conn)
+{
+	sys_slist_find_and_remove(tcp_conn_bucket(&conn->src, &conn->dst),
+				  &conn->hash_next);
+}
+
 int net_tcp_endpoint_copy(struct net_context *ctx,
 			  struct sockaddr *local,
 			  struct sockaddr *peer,
@@ -806,6 +865,9 @@ static void tcp_conn_release(struct k_work *work)
 	(void)k_work_cancel_delayable(&conn->ack_timer);
 	(void)k_work_cancel_delayable(&conn->send_timer);
 	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
+#if defined(CONFIG_NET_TCP_SACK)
+	(void)k_work_cancel_delayable(&conn->rack_timer);
+#endif
 	keep_alive_timer_stop(conn);
 
 	k_mutex_unlock(&conn->lock);
@@ -814,6 +876,7 @@ static void tcp_conn_release(struct k_work *work)
 	conn->context = NULL;
 
 	k_mutex_lock(&tcp_lock, K_FOREVER);
+	tcp_conn_hash_remove(conn);
 	sys_slist_find_and_remove(&tcp_conns, &conn->next);
 	k_mutex_unlock(&tcp_lock);
 
@@ -1098,9 +1161,9 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
-
+	/* MSS and window scale only come with the SYN, what was found there
+	 * stays valid when later segments carry other options.
+	 */
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
 
@@ -1148,6 +1211,37 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#if defined(CONFIG_NET_TCP_SACK)
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if (opt_len < 2 + NET_TCP_SACK_BLOCK_SIZE ||
+			    (opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_count = MIN((opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE,
+						       NET_TCP_SACK_MAX_BLOCKS);
+
+			for (int i = 0; i < recv_options->sack_count; i++) {
+				uint8_t *block = options + 2 + i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+
+			NET_DBG("%hu SACK blocks", (uint16_t)recv_options->sack_count);
+			break;
+#endif /* CONFIG_NET_TCP_SACK */
 		default:
 			continue;
 		}
@@ -1339,7 +1433,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1353,11 +1447,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -1437,6 +1527,78 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+static inline bool tcp_sack_enabled(struct tcp *conn)
+{
+#if defined(CONFIG_NET_TCP_SACK)
+	return conn->recv_options.sack_perm_found;
+#else
+	return false;
+#endif
+}
+
+#if defined(CONFIG_NET_TCP_SACK)
+/* SACK is offered in a SYN, and accepted in a SYN-ACK if the peer offered
+ * it. Pure ACKs report the out-of-order data that is queued, if any.
+ */
+static size_t tcp_sack_opt_len(struct tcp *conn, uint8_t flags, bool data)
+{
+	if (flags & SYN) {
+		if (!(flags & ACK) || tcp_sack_enabled(conn)) {
+			return NET_TCP_NOP_SIZE * 2 + NET_TCP_SACK_PERM_SIZE;
+		}
+
+		return 0;
+	}
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT && !data && (flags & ACK) &&
+	    tcp_sack_enabled(conn) && conn->queue_recv_data != NULL &&
+	    conn->queue_recv_data->buffer != NULL) {
+		return NET_TCP_NOP_SIZE * 2 + 2 + NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return 0;
+}
+
+static int tcp_sack_opt_add(struct tcp *conn, struct net_pkt *pkt,
+			    size_t opts_len)
+{
+	uint8_t opts[NET_TCP_NOP_SIZE * 2 + 2 + NET_TCP_SACK_BLOCK_SIZE] = {
+		NET_TCP_NOP_OPT, NET_TCP_NOP_OPT,
+	};
+
+	if (opts_len == 0) {
+		return 0;
+	}
+
+	if (opts_len == NET_TCP_NOP_SIZE * 2 + NET_TCP_SACK_PERM_SIZE) {
+		opts[2] = NET_TCP_SACK_PERM_OPT;
+		opts[3] = NET_TCP_SACK_PERM_SIZE;
+	} else {
+		/* The queued data is contiguous, so it fits in one block */
+		uint32_t start = tcp_get_seq(conn->queue_recv_data->buffer);
+		uint32_t end = start + net_pkt_get_len(conn->queue_recv_data);
+
+		opts[2] = NET_TCP_SACK_OPT;
+		opts[3] = 2 + NET_TCP_SACK_BLOCK_SIZE;
+		UNALIGNED_PUT(htonl(start), (uint32_t *)&opts[4]);
+		UNALIGNED_PUT(htonl(end), (uint32_t *)&opts[8]);
+	}
+
+	return net_pkt_write(pkt, opts, opts_len);
+}
+#else
+static size_t tcp_sack_opt_len(struct tcp *conn, uint8_t flags, bool data)
+{
+	return 0;
+}
+
+static int tcp_sack_opt_add(struct tcp *conn, struct net_pkt *pkt,
+			    size_t opts_len)
+{
+	return 0;
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1542,13 +1704,18 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
 	size_t alloc_len = sizeof(struct tcphdr);
+	size_t sack_opt_len = tcp_sack_opt_len(conn, flags, data != NULL);
+	size_t opts_len = sack_opt_len;
 	struct net_pkt *pkt;
+	bool local;
 	int ret = 0;
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += sizeof(uint32_t);
 	}
 
+	alloc_len += opts_len;
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1567,7 +1734,16 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	local = is_destination_local(pkt);
+
+	/* A super-segment going to our own stack is received as it is,
+	 * only the ones leaving the host are split into segments.
+	 */
+	if (data && !local) {
+		net_pkt_set_gso_size(pkt, net_pkt_gso_size(data));
+	}
+
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1581,6 +1757,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_sack_opt_add(conn, pkt, sack_opt_len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1598,7 +1780,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		conn->recv_win_sent = conn->recv_win;
 	}
 
-	if (is_destination_local(pkt)) {
+	if (local) {
 		/* If the destination is local, we have to let the current
 		 * thread to finish with any state-machine changes before
 		 * sending the packet, or it might lead to state inconsistencies
@@ -1736,11 +1918,277 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+/* Allocate the data of a super-segment of several MSS worth of unsent
+ * data, which is split into segments only right before L2. Nagle's
+ * algorithm is applied by leaving a trailing partial segment out.
+ */
+static struct net_pkt *tcp_gso_pkt_alloc(struct tcp *conn, int *len)
+{
+	uint16_t mss = conn_mss(conn);
+	struct net_pkt *pkt;
+	int gso_len;
+
+	if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+		return NULL;
+	}
+
+	gso_len = MIN(tcp_unsent_len(conn),
+		      ROUND_DOWN(CONFIG_NET_TCP_GSO_MAX_SIZE, mss));
+	if (!conn->tcp_nodelay) {
+		gso_len = ROUND_DOWN(gso_len, mss);
+	}
+
+	if (gso_len <= mss) {
+		return NULL;
+	}
+
+	pkt = tcp_pkt_alloc(conn, 0);
+	if (!pkt) {
+		return NULL;
+	}
+
+	/* The buffer is larger than the MTU, so it cannot be allocated
+	 * through tcp_pkt_alloc(). Do not wait for it, sending single
+	 * segments is better than stalling.
+	 */
+	if (net_pkt_alloc_buffer_raw(pkt, gso_len, K_NO_WAIT) < 0) {
+		tcp_pkt_unref(pkt);
+		return NULL;
+	}
+
+	net_pkt_set_gso_size(pkt, mss);
+	*len = gso_len;
+
+	return pkt;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
+#if defined(CONFIG_NET_TCP_SACK)
+/* SACK (RFC 2018) and RACK-TLP (RFC 8985) loss recovery.
+ *
+ * The scoreboard has an entry for each chunk of data sent and not
+ * cumulatively acknowledged yet, in sequence order. Entries are marked as
+ * acknowledged from the SACK blocks of the peer, and as lost when data sent
+ * after them was delivered more than a reordering window ago.
+ */
+
+#define TCP_TLP_MIN_PTO_MS 10
+
+static uint32_t tcp_sack_seg_end(struct tcp_sack_seg *seg)
+{
+	return seg->seq + seg->len;
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack.count = 0;
+	conn->sack.in_recovery = false;
+	conn->sack.tlp_armed = false;
+	conn->sack.tlp_in_flight = false;
+
+	(void)k_work_cancel_delayable(&conn->rack_timer);
+}
+
+static void tcp_sack_remove(struct tcp *conn, int idx)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+
+	sb->count--;
+	memmove(&sb->segs[idx], &sb->segs[idx + 1],
+		(sb->count - idx) * sizeof(sb->segs[0]));
+}
+
+/* Split an entry in two at the given sequence number, so that each part
+ * can be marked on its own.
+ */
+static bool tcp_sack_split(struct tcp *conn, int idx, uint32_t seq)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	struct tcp_sack_seg *seg = &sb->segs[idx];
+	uint32_t end = tcp_sack_seg_end(seg);
+
+	if (sb->count == ARRAY_SIZE(sb->segs)) {
+		return false;
+	}
+
+	memmove(seg + 1, seg, (sb->count - idx) * sizeof(*seg));
+	sb->count++;
+
+	seg[0].len = seq - seg[0].seq;
+	seg[1].seq = seq;
+	seg[1].len = end - seq;
+
+	return true;
+}
+
+/* Was the data ending at seq1 sent after the one ending at seq2 */
+static bool tcp_rack_sent_after(uint32_t time1, uint32_t seq1,
+				uint32_t time2, uint32_t seq2)
+{
+	int32_t diff = (int32_t)(time1 - time2);
+
+	return diff > 0 || (diff == 0 && net_tcp_seq_greater(seq1, seq2));
+}
+
+static uint32_t tcp_rack_reo_wnd(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	int sacked = 0;
+
+	if (!sb->reord) {
+		if (sb->in_recovery) {
+			return 0;
+		}
+
+		for (int i = 0; i < sb->count; i++) {
+			if (sb->segs[i].flags & TCP_SACK_SEG_SACKED) {
+				sacked++;
+			}
+		}
+
+		if (sacked >= DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) {
+			return 0;
+		}
+	}
+
+	return MIN(sb->min_rtt / 4, sb->srtt);
+}
+
+/* Arm the RACK reordering timer if some data may become lost, or else the
+ * tail loss probe timer if data is in flight.
+ */
+static void tcp_rack_timer_update(struct tcp *conn, uint32_t reo_timeout)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t rto_left;
+	uint32_t pto;
+
+	sb->tlp_armed = false;
+
+	if (reo_timeout > 0) {
+		k_work_reschedule_for_queue(&tcp_work_q, &conn->rack_timer,
+					    K_MSEC(reo_timeout));
+		return;
+	}
+
+	if (sb->count == 0 || sb->in_recovery || sb->tlp_in_flight ||
+	    !sb->rtt_valid) {
+		(void)k_work_cancel_delayable(&conn->rack_timer);
+		return;
+	}
+
+	pto = MAX(2 * sb->srtt, TCP_TLP_MIN_PTO_MS);
+	if (conn->unacked_len <= conn_mss(conn)) {
+		/* A single segment may be waiting for a delayed ACK */
+		pto += ACK_DELAY_MS;
+	}
+
+	/* Leave it to the retransmission timer if it expires first */
+	rto_left = k_ticks_to_ms_floor32(
+		k_work_delayable_remaining_get(&conn->send_data_timer));
+	if (rto_left > 0 && pto >= rto_left) {
+		(void)k_work_cancel_delayable(&conn->rack_timer);
+		return;
+	}
+
+	sb->tlp_armed = true;
+	k_work_reschedule_for_queue(&tcp_work_q, &conn->rack_timer, K_MSEC(pto));
+}
+
+static void tcp_sack_sent(struct tcp *conn, uint32_t seq, size_t len)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	struct tcp_sack_seg *seg;
+
+	/* Data sent after a retransmission timeout is not tracked */
+	if (!tcp_sack_enabled(conn) || conn->data_mode == TCP_DATA_MODE_RESEND) {
+		return;
+	}
+
+	/* Forget what was known about data that is sent again */
+	while (sb->count > 0 &&
+	       net_tcp_seq_cmp(sb->segs[sb->count - 1].seq, seq) >= 0) {
+		sb->count--;
+	}
+
+	if (sb->count > 0) {
+		seg = &sb->segs[sb->count - 1];
+
+		if (net_tcp_seq_cmp(tcp_sack_seg_end(seg), seq) > 0) {
+			seg->len = seq - seg->seq;
+		}
+	}
+
+	if (sb->count == ARRAY_SIZE(sb->segs)) {
+		/* Out of entries, merge the data into the last one */
+		seg = &sb->segs[sb->count - 1];
+		seg->len = seq + len - seg->seq;
+	} else {
+		seg = &sb->segs[sb->count++];
+		seg->seq = seq;
+		seg->len = len;
+	}
+
+	seg->flags = 0;
+	seg->xmit_time = k_uptime_get_32();
+
+	/* Restart the probe timeout after new data, but leave a pending
+	 * reordering timer alone
+	 */
+	if (sb->tlp_armed || !k_work_delayable_is_pending(&conn->rack_timer)) {
+		tcp_rack_timer_update(conn, 0);
+	}
+}
+
+/* Send again data that is in flight, in MSS sized segments */
+static int tcp_sack_send_seg(struct tcp *conn, uint32_t seq, size_t len)
+{
+	struct net_pkt *pkt;
+	size_t seg_len;
+	int ret;
+
+	while (len > 0) {
+		seg_len = MIN(len, conn_mss(conn));
+
+		pkt = tcp_pkt_alloc(conn, seg_len);
+		if (!pkt) {
+			return -ENOBUFS;
+		}
+
+		ret = tcp_pkt_peek(pkt, conn->send_data, seq - conn->seq, seg_len);
+		if (ret == 0) {
+			ret = tcp_out_ext(conn, PSH | ACK, pkt, seq);
+		}
+
+		tcp_pkt_unref(pkt);
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		net_stats_update_tcp_resent(conn->iface, seg_len);
+		net_stats_update_tcp_seg_rexmit(conn->iface);
+
+		seq += seg_len;
+		len -= seg_len;
+	}
+
+	return 0;
+}
+#else
+
+static void tcp_sack_reset(struct tcp *conn) { }
+
+static void tcp_sack_sent(struct tcp *conn, uint32_t seq, size_t len) { }
+
+#endif /* CONFIG_NET_TCP_SACK */
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
-	struct net_pkt *pkt;
+	struct net_pkt *pkt = NULL;
 
 	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
 	if (len < 0) {
@@ -1753,7 +2201,12 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
+#if defined(CONFIG_NET_TCP_GSO)
+	pkt = tcp_gso_pkt_alloc(conn, &len);
+#endif
+	if (!pkt) {
+		pkt = tcp_pkt_alloc(conn, len);
+	}
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
 		ret = -ENOBUFS;
@@ -1770,6 +2223,7 @@ static int tcp_send_data(struct tcp *conn)
 	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
 	if (ret == 0) {
 		conn->unacked_len += len;
+		tcp_sack_sent(conn, conn->seq + conn->unacked_len - len, len);
 
 		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 			net_stats_update_tcp_resent(conn->iface, len);
@@ -1786,59 +2240,392 @@ static int tcp_send_data(struct tcp *conn)
 	 */
 	tcp_pkt_unref(pkt);
 
-	conn_send_data_dump(conn);
+	conn_send_data_dump(conn);
+
+ out:
+	return ret;
+}
+
+/* Send all queued but unsent data from the send_data packet by packet
+ * until the receiver's window is full. */
+static int tcp_send_queued_data(struct tcp *conn)
+{
+	int ret = 0;
+	bool subscribe = false;
+
+	if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+		goto out;
+	}
+
+	while (tcp_unsent_len(conn) > 0) {
+		/* Implement Nagle's algorithm */
+		if ((conn->tcp_nodelay == false) && (conn->unacked_len > 0)) {
+			/* If there is already pending data */
+			if (tcp_unsent_len(conn) < conn_mss(conn)) {
+				/* The number of bytes to be transmitted is less than an MSS,
+				 * skip transmission for now.
+				 * Wait for more data to be transmitted or all pending data
+				 * being acknowledged.
+				 */
+				break;
+			}
+		}
+
+		ret = tcp_send_data(conn);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	if (conn->send_data_total) {
+		subscribe = true;
+	}
+
+	if (k_work_delayable_remaining_get(&conn->send_data_timer)) {
+		subscribe = false;
+	}
+
+	if (subscribe) {
+		conn->send_data_retries = 0;
+		k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer,
+					    K_MSEC(TCP_RTO_MS));
+	}
+ out:
+	return ret;
+}
+
+#if defined(CONFIG_NET_TCP_SACK)
+/* Account for data that reached the peer, see RACK_update() of RFC 8985 */
+static void tcp_rack_update(struct tcp *conn, struct tcp_sack_seg *seg,
+			    uint32_t now)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t end = tcp_sack_seg_end(seg);
+	uint32_t rtt = now - seg->xmit_time;
+
+	if (seg->flags & TCP_SACK_SEG_RETRANS) {
+		/* Acknowledged too soon to be for the retransmission */
+		if (sb->rtt_valid && rtt < sb->min_rtt) {
+			return;
+		}
+	} else {
+		if (sb->rtt_valid) {
+			sb->min_rtt = MIN(sb->min_rtt, rtt);
+			sb->srtt = (7 * sb->srtt + rtt) / 8;
+		} else {
+			sb->min_rtt = rtt;
+			sb->srtt = rtt;
+			sb->rtt_valid = true;
+		}
+
+		/* Delivered before data sent earlier, the network reorders */
+		if (sb->rack_valid && net_tcp_seq_greater(sb->rack_end_seq, end)) {
+			sb->reord = true;
+		}
+	}
+
+	if (!sb->rack_valid ||
+	    tcp_rack_sent_after(seg->xmit_time, end, sb->rack_xmit_time,
+				sb->rack_end_seq)) {
+		sb->rack_xmit_time = seg->xmit_time;
+		sb->rack_end_seq = end;
+		sb->rack_rtt = rtt;
+		sb->rack_valid = true;
+	}
+}
+
+/* Mark as lost the data sent long enough before the most recently sent
+ * data that was delivered. Returns the time in ms after which more data may
+ * be found lost, 0 if none.
+ */
+static uint32_t tcp_rack_detect_loss(struct tcp *conn, uint32_t now, bool *lost)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t reo_wnd = tcp_rack_reo_wnd(conn);
+	uint32_t timeout = 0;
+	int32_t remaining;
+
+	if (!sb->rack_valid) {
+		return 0;
+	}
+
+	for (int i = 0; i < sb->count; i++) {
+		struct tcp_sack_seg *seg = &sb->segs[i];
+
+		if (seg->flags & (TCP_SACK_SEG_SACKED | TCP_SACK_SEG_LOST)) {
+			continue;
+		}
+
+		if (!tcp_rack_sent_after(sb->rack_xmit_time, sb->rack_end_seq,
+					 seg->xmit_time, tcp_sack_seg_end(seg))) {
+			continue;
+		}
+
+		remaining = (int32_t)(seg->xmit_time + sb->rack_rtt + reo_wnd - now);
+		if (remaining <= 0) {
+			seg->flags |= TCP_SACK_SEG_LOST;
+			*lost = true;
+		} else {
+			timeout = MAX(timeout, (uint32_t)remaining);
+		}
+	}
+
+	return timeout;
+}
+
+static void tcp_sack_mark(struct tcp *conn, struct tcp_sack_block *block,
+			  uint32_t now)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+
+	for (int i = 0; i < sb->count; i++) {
+		struct tcp_sack_seg *seg = &sb->segs[i];
+
+		if (net_tcp_seq_cmp(seg->seq, block->end) >= 0) {
+			break;
+		}
+
+		if ((seg->flags & TCP_SACK_SEG_SACKED) ||
+		    net_tcp_seq_cmp(tcp_sack_seg_end(seg), block->start) <= 0) {
+			continue;
+		}
+
+		/* Only the part covered by the block is acknowledged, the
+		 * next round of the loop gets to the second part.
+		 */
+		if (net_tcp_seq_cmp(seg->seq, block->start) < 0) {
+			(void)tcp_sack_split(conn, i, block->start);
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(tcp_sack_seg_end(seg), block->end) > 0 &&
+		    !tcp_sack_split(conn, i, block->end)) {
+			continue;
+		}
+
+		seg->flags = (seg->flags | TCP_SACK_SEG_SACKED) & ~TCP_SACK_SEG_LOST;
+		tcp_rack_update(conn, seg, now);
+	}
+}
+
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+/* Data in flight, the pipe of RFC 6675: the data sent and neither
+ * selectively acknowledged nor lost, retransmissions included.
+ */
+static uint32_t tcp_sack_pipe(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t pipe = 0;
+
+	for (int i = 0; i < sb->count; i++) {
+		if (!(sb->segs[i].flags & (TCP_SACK_SEG_SACKED | TCP_SACK_SEG_LOST))) {
+			pipe += sb->segs[i].len;
+		}
+	}
+
+	return pipe;
+}
+
+/* How much lost data the congestion window lets us send again now.
+ * New Reno inflates cwnd for the segments which left the network and
+ * deflates it as partial ACKs come in, which the pipe already accounts
+ * for: during recovery the window is ssthresh, as in RFC 6675.
+ */
+static uint32_t tcp_sack_retransmit_budget(struct tcp *conn)
+{
+	uint32_t pipe = tcp_sack_pipe(conn);
+	uint32_t wnd = conn->sack.in_recovery ? conn->ca.ssthresh : conn->ca.cwnd;
+
+	return pipe < wnd ? wnd - pipe : 0;
+}
+#else
+static uint32_t tcp_sack_retransmit_budget(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+
+	return UINT32_MAX;
+}
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE */
+
+/* Send again the data marked lost, as far as the congestion window allows.
+ * The rest stays marked lost, for the next ACK to send.
+ */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t budget = tcp_sack_retransmit_budget(conn);
+	uint32_t mss = conn_mss(conn);
+
+	for (int i = 0; i < sb->count; i++) {
+		struct tcp_sack_seg *seg = &sb->segs[i];
+
+		if (!(seg->flags & TCP_SACK_SEG_LOST)) {
+			continue;
+		}
+
+		/* Only whole segments, unless the lost data is shorter */
+		if (budget < MIN(seg->len, mss)) {
+			break;
+		}
+
+		if (seg->len > budget &&
+		    !tcp_sack_split(conn, i, seg->seq + ROUND_DOWN(budget, mss))) {
+			break;
+		}
+
+		NET_DBG("conn: %p retransmit lost seq=%u len=%hu", conn,
+			seg->seq, seg->len);
+
+		if (tcp_sack_send_seg(conn, seg->seq, seg->len) < 0) {
+			/* Try again on the next ACK or timer */
+			break;
+		}
+
+		seg->flags = (seg->flags & ~TCP_SACK_SEG_LOST) | TCP_SACK_SEG_RETRANS;
+		seg->xmit_time = k_uptime_get_32();
+		budget -= seg->len;
+	}
+}
+
+static void tcp_rack_recover(struct tcp *conn, uint32_t now)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	bool lost = false;
+	uint32_t timeout;
+
+	timeout = tcp_rack_detect_loss(conn, now, &lost);
+	if (lost) {
+		if (!sb->in_recovery) {
+			sb->in_recovery = true;
+			sb->recovery_point = conn->seq + conn->unacked_len;
+			tcp_ca_fast_retransmit(conn);
+		}
+	}
+
+	/* Data lost earlier may have been left for the window to open */
+	if (lost || sb->in_recovery) {
+		tcp_sack_retransmit(conn);
+	}
+
+	tcp_rack_timer_update(conn, timeout);
+}
+
+/* Probe for a lost tail, with new data if possible or else with the last
+ * segment sent, so that the loss is reported by SACK instead of waiting for
+ * the retransmission timer.
+ */
+static void tcp_tlp_send_probe(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	struct tcp_sack_seg *seg = &sb->segs[sb->count - 1];
+	size_t len;
+
+	sb->tlp_in_flight = true;
+
+	if (tcp_unsent_len(conn) > 0 && tcp_send_data(conn) == 0) {
+		NET_DBG("conn: %p TLP with new data", conn);
+	} else {
+		len = MIN(seg->len, conn_mss(conn));
+
+		NET_DBG("conn: %p TLP seq=%u len=%zu", conn,
+			tcp_sack_seg_end(seg) - len, len);
+
+		if (tcp_sack_send_seg(conn, tcp_sack_seg_end(seg) - len, len) == 0) {
+			seg->flags |= TCP_SACK_SEG_RETRANS;
+			seg->xmit_time = k_uptime_get_32();
+		}
+	}
+
+	sb->tlp_end_seq = conn->seq + conn->unacked_len;
+}
+
+static void tcp_rack_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, rack_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if (conn->sack.count == 0 || conn->data_mode == TCP_DATA_MODE_RESEND) {
+		goto out;
+	}
+
+	if (conn->sack.tlp_armed) {
+		conn->sack.tlp_armed = false;
+		tcp_tlp_send_probe(conn);
+	} else {
+		tcp_rack_recover(conn, k_uptime_get_32());
+	}
 
- out:
-	return ret;
+out:
+	k_mutex_unlock(&conn->lock);
 }
 
-/* Send all queued but unsent data from the send_data packet by packet
- * until the receiver's window is full. */
-static int tcp_send_queued_data(struct tcp *conn)
+/* Update the scoreboard from the ACK and SACK blocks of a segment, and
+ * retransmit the data found lost. This runs before the cumulative
+ * acknowledgment is processed, while conn->seq still is the first
+ * sequence number of conn->send_data.
+ */
+static void tcp_sack_ack(struct tcp *conn, uint32_t ack)
 {
-	int ret = 0;
-	bool subscribe = false;
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+	uint32_t now = k_uptime_get_32();
+	struct tcp_sack_seg *seg;
 
-	if (conn->data_mode == TCP_DATA_MODE_RESEND) {
-		goto out;
+	if (!tcp_sack_enabled(conn) || conn->data_mode == TCP_DATA_MODE_RESEND ||
+	    net_tcp_seq_cmp(ack, conn->seq) < 0 ||
+	    net_tcp_seq_cmp(ack, snd_nxt) > 0) {
+		return;
 	}
 
-	while (tcp_unsent_len(conn) > 0) {
-		/* Implement Nagle's algorithm */
-		if ((conn->tcp_nodelay == false) && (conn->unacked_len > 0)) {
-			/* If there is already pending data */
-			if (tcp_unsent_len(conn) < conn_mss(conn)) {
-				/* The number of bytes to be transmitted is less than an MSS,
-				 * skip transmission for now.
-				 * Wait for more data to be transmitted or all pending data
-				 * being acknowledged.
-				 */
-				break;
-			}
+	while (sb->count > 0 &&
+	       net_tcp_seq_cmp(tcp_sack_seg_end(&sb->segs[0]), ack) <= 0) {
+		if (!(sb->segs[0].flags & TCP_SACK_SEG_SACKED)) {
+			tcp_rack_update(conn, &sb->segs[0], now);
 		}
 
-		ret = tcp_send_data(conn);
-		if (ret < 0) {
-			break;
-		}
+		tcp_sack_remove(conn, 0);
 	}
 
-	if (conn->send_data_total) {
-		subscribe = true;
+	seg = &sb->segs[0];
+	if (sb->count > 0 && net_tcp_seq_cmp(seg->seq, ack) < 0) {
+		seg->len = tcp_sack_seg_end(seg) - ack;
+		seg->seq = ack;
 	}
 
-	if (k_work_delayable_remaining_get(&conn->send_data_timer)) {
-		subscribe = false;
+	if (net_tcp_seq_cmp(ack, conn->seq) > 0) {
+		if (sb->in_recovery &&
+		    net_tcp_seq_cmp(ack, sb->recovery_point) >= 0) {
+			sb->in_recovery = false;
+		}
+
+		if (sb->tlp_in_flight &&
+		    net_tcp_seq_cmp(ack, sb->tlp_end_seq) >= 0) {
+			sb->tlp_in_flight = false;
+		}
 	}
 
-	if (subscribe) {
-		conn->send_data_retries = 0;
-		k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer,
-					    K_MSEC(TCP_RTO_MS));
+	for (int i = 0; i < conn->recv_options.sack_count; i++) {
+		struct tcp_sack_block *block = &conn->recv_options.sack[i];
+
+		/* Skip blocks that are not about data in flight */
+		if (net_tcp_seq_cmp(block->start, ack) < 0 ||
+		    net_tcp_seq_cmp(block->end, snd_nxt) > 0 ||
+		    net_tcp_seq_cmp(block->start, block->end) >= 0) {
+			continue;
+		}
+
+		tcp_sack_mark(conn, block, now);
 	}
- out:
-	return ret;
+
+	tcp_rack_recover(conn, now);
 }
+#else
+
+static void tcp_sack_ack(struct tcp *conn, uint32_t ack) { }
+
+#endif /* CONFIG_NET_TCP_SACK */
 
 static void tcp_cleanup_recv_queue(struct k_work *work)
 {
@@ -1886,6 +2673,9 @@ static void tcp_resend_data(struct k_work *work)
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
 
+	/* What the peer reported with SACK may be reneged, start over */
+	tcp_sack_reset(conn);
+
 	ret = tcp_send_data(conn);
 	conn->send_data_retries++;
 	if (ret == 0) {
@@ -2156,6 +2946,9 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#if defined(CONFIG_NET_TCP_SACK)
+	k_work_init_delayable(&conn->rack_timer, tcp_rack_timeout);
+#endif
 	k_work_init(&conn->conn_release, tcp_conn_release);
 	keep_alive_timer_init(conn);
 
@@ -2197,34 +2990,37 @@ int net_tcp_get(struct net_context *context)
 	return ret;
 }
 
-static bool tcp_endpoint_cmp(union tcp_endpoint *ep, struct net_pkt *pkt,
-			     enum pkt_addr which)
+static bool tcp_endpoint_cmp(const union tcp_endpoint *ep,
+			     const union tcp_endpoint *ep_pkt)
 {
-	union tcp_endpoint ep_tmp;
-
-	if (tcp_endpoint_set(&ep_tmp, pkt, which) < 0) {
-		return false;
-	}
-
-	return !memcmp(ep, &ep_tmp, tcp_endpoint_len(ep->sa.sa_family));
+	return !memcmp(ep, ep_pkt, tcp_endpoint_len(ep_pkt->sa.sa_family));
 }
 
-static bool tcp_conn_cmp(struct tcp *conn, struct net_pkt *pkt)
+static bool tcp_conn_cmp(struct tcp *conn, const union tcp_endpoint *src,
+			 const union tcp_endpoint *dst)
 {
-	return tcp_endpoint_cmp(&conn->src, pkt, TCP_EP_DST) &&
-		tcp_endpoint_cmp(&conn->dst, pkt, TCP_EP_SRC);
+	return tcp_endpoint_cmp(&conn->src, src) &&
+		tcp_endpoint_cmp(&conn->dst, dst);
 }
 
 static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 {
+	union tcp_endpoint src;
+	union tcp_endpoint dst;
 	bool found = false;
 	struct tcp *conn;
-	struct tcp *tmp;
+
+	/* Our endpoints are the packet's destination and source */
+	if (tcp_endpoint_set(&src, pkt, TCP_EP_DST) < 0 ||
+	    tcp_endpoint_set(&dst, pkt, TCP_EP_SRC) < 0) {
+		return NULL;
+	}
 
 	k_mutex_lock(&tcp_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&tcp_conns, conn, tmp, next) {
-		found = tcp_conn_cmp(conn, pkt);
+	SYS_SLIST_FOR_EACH_CONTAINER(tcp_conn_bucket(&src, &dst), conn,
+				     hash_next) {
+		found = tcp_conn_cmp(conn, &src, &dst);
 		if (found) {
 			break;
 		}
@@ -2235,6 +3031,169 @@ static struct tcp *tcp_conn_search(struct net_pkt *pkt)
 	return found ? conn : NULL;
 }
 
+#if defined(CONFIG_NET_TCP_GRO)
+/* Connections holding coalesced segments, until the RX thread is done
+ * with the packets it has queued.
+ */
+static sys_slist_t tcp_gro_conns = SYS_SLIST_STATIC_INIT(&tcp_gro_conns);
+static K_MUTEX_DEFINE(tcp_gro_lock);
+
+/* Only plain in-order data segments are coalesced. Segments with TCP
+ * options are left alone, so that there are no options to compare.
+ */
+static bool tcp_gro_segment_ok(struct tcp *conn, struct tcphdr *th, size_t len)
+{
+	return conn->state == TCP_ESTABLISHED &&
+		(th_flags(th) & ~PSH) == ACK && th_off(th) == 5 && len > 0;
+}
+
+/* Must be called with tcp_gro_lock held. The connection reference taken
+ * when the segments were held is passed to the caller.
+ */
+static struct net_pkt *tcp_gro_take(struct tcp *conn)
+{
+	struct net_pkt *pkt = conn->gro_pkt;
+
+	if (pkt != NULL) {
+		conn->gro_pkt = NULL;
+		(void)sys_slist_find_and_remove(&tcp_gro_conns, &conn->gro_next);
+	}
+
+	return pkt;
+}
+
+static void tcp_gro_input(struct tcp *conn, struct net_pkt *pkt)
+{
+	if (tcp_in(conn, pkt) != NET_OK) {
+		tcp_pkt_unref(pkt);
+	}
+
+	tcp_conn_unref(conn);
+}
+
+static bool tcp_gro_merge(struct tcp *conn, struct net_pkt *held,
+			  struct net_pkt *pkt, struct tcphdr *th, size_t len)
+{
+	struct tcphdr *held_th;
+	uint8_t flags;
+	uint16_t win;
+
+	if (!tcp_gro_segment_ok(conn, th, len) || th_seq(th) != conn->gro_seq) {
+		return false;
+	}
+
+	held_th = th_get(held);
+	if (held_th == NULL || th_ack(th) != th_ack(held_th) ||
+	    conn->gro_seq - th_seq(held_th) + len > CONFIG_NET_TCP_GRO_MAX_SIZE) {
+		return false;
+	}
+
+	flags = th_flags(th);
+	win = UNALIGNED_GET(&th->th_win);
+
+	if (tcp_pkt_pull(pkt, net_pkt_get_len(pkt) - len) < 0) {
+		return false;
+	}
+
+	/* The data goes at the end of the held segment, which then looks
+	 * like it was received with the latest window and push flag.
+	 */
+	net_pkt_append_buffer(held, pkt->buffer);
+	pkt->buffer = NULL;
+	tcp_pkt_unref(pkt);
+
+	UNALIGNED_PUT((uint8_t)(th_flags(held_th) | (flags & PSH)),
+		      &held_th->th_flags);
+	UNALIGNED_PUT(win, &held_th->th_win);
+
+	conn->gro_seq += len;
+
+	return true;
+}
+
+/* Coalesce in-order data segments received by the RX thread, so that the
+ * data is processed and passed to the application in larger chunks.
+ * Returns true if the packet was consumed.
+ */
+static bool tcp_gro_receive(struct tcp *conn, struct net_pkt *pkt)
+{
+	struct net_pkt *flush = NULL;
+	bool consumed = false;
+	struct tcphdr *th;
+	size_t len;
+
+	th = net_tc_is_rx_thread() ? th_get(pkt) : NULL;
+	if (th == NULL) {
+		/* The segment is processed right away, so whatever is held
+		 * must go first, or the held data would be received after it.
+		 */
+		k_mutex_lock(&tcp_gro_lock, K_FOREVER);
+		flush = tcp_gro_take(conn);
+		k_mutex_unlock(&tcp_gro_lock);
+
+		if (flush != NULL) {
+			tcp_gro_input(conn, flush);
+		}
+
+		return false;
+	}
+
+	len = tcp_data_len(pkt);
+
+	k_mutex_lock(&tcp_gro_lock, K_FOREVER);
+
+	if (conn->gro_pkt != NULL &&
+	    tcp_gro_merge(conn, conn->gro_pkt, pkt, th, len)) {
+		consumed = true;
+
+		/* The sender has no more data for now */
+		if (th_flags(th_get(conn->gro_pkt)) & PSH) {
+			flush = tcp_gro_take(conn);
+		}
+	} else {
+		/* Whatever is held comes before this segment */
+		flush = tcp_gro_take(conn);
+
+		if (tcp_gro_segment_ok(conn, th, len) && !(th_flags(th) & PSH)) {
+			tcp_conn_ref(conn);
+			conn->gro_pkt = pkt;
+			conn->gro_seq = th_seq(th) + len;
+			sys_slist_append(&tcp_gro_conns, &conn->gro_next);
+			consumed = true;
+		}
+	}
+
+	k_mutex_unlock(&tcp_gro_lock);
+
+	if (flush != NULL) {
+		tcp_gro_input(conn, flush);
+	}
+
+	return consumed;
+}
+
+void net_tcp_gro_flush(void)
+{
+	struct net_pkt *pkt;
+	struct tcp *conn;
+
+	while (true) {
+		k_mutex_lock(&tcp_gro_lock, K_FOREVER);
+
+		conn = SYS_SLIST_PEEK_HEAD_CONTAINER(&tcp_gro_conns, conn, gro_next);
+		pkt = conn != NULL ? tcp_gro_take(conn) : NULL;
+
+		k_mutex_unlock(&tcp_gro_lock);
+
+		if (pkt == NULL) {
+			break;
+		}
+
+		tcp_gro_input(conn, pkt);
+	}
+}
+#endif /* CONFIG_NET_TCP_GRO */
+
 static struct tcp *tcp_conn_new(struct net_pkt *pkt);
 
 static enum net_verdict tcp_recv(struct net_conn *net_conn,
@@ -2270,6 +3229,11 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 	}
 in:
 	if (conn) {
+#if defined(CONFIG_NET_TCP_GRO)
+		if (tcp_gro_receive(conn, pkt)) {
+			return NET_OK;
+		}
+#endif
 		verdict = tcp_in(conn, pkt);
 	} else {
 		net_tcp_reply_rst(pkt);
@@ -2421,6 +3385,8 @@ static struct tcp *tcp_conn_new(struct net_pkt *pkt)
 		goto err;
 	}
 
+	tcp_conn_hash_add(conn);
+
 	NET_DBG("conn: src: %s, dst: %s",
 		net_sprint_addr(conn->src.sa.sa_family,
 				(const void *)&conn->src.sin.sin_addr),
@@ -2869,6 +3835,11 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	/* SACK blocks are only valid for the segment they came with */
+	conn->recv_options.sack_count = 0;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
 						  tcp_options_len)) {
 		NET_DBG("DROP: Invalid TCP option list");
@@ -3136,6 +4107,10 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+		if (th) {
+			tcp_sack_ack(conn, th_ack(th));
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3153,8 +4128,11 @@ next_state:
 				conn->dup_ack_cnt = 0;
 			}
 
-			/* Only do fast retransmit when not already in a resend state */
+			/* Only do fast retransmit when not already in a resend state,
+			 * with SACK the lost data is found and resent by RACK instead.
+			 */
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+			    !tcp_sack_enabled(conn) &&
 			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
 				/* Apply a fast retransmit */
 				int temp_unacked_len = conn->unacked_len;
@@ -3307,6 +4285,7 @@ next_state:
 		if (conn->send_data_total == 0) {
 			conn->send_data_retries = 0;
 			k_work_cancel_delayable(&conn->send_data_timer);
+			tcp_sack_reset(conn);
 		}
 
 		/* A lot could have happened to the transmission window check the situation here */
@@ -3837,6 +4816,11 @@ int net_tcp_connect(struct net_context *context,
 	conn->iface = net_context_get_iface(context);
 	tcp_derive_rto(conn);
 
+	/* In case of a previous connection attempt */
+	k_mutex_lock(&tcp_lock, K_FOREVER);
+	tcp_conn_hash_remove(conn);
+	k_mutex_unlock(&tcp_lock);
+
 	switch (net_context_get_family(context)) {
 		const struct in_addr *ip4;
 		const struct in6_addr *ip6;
@@ -3907,6 +4891,10 @@ int net_tcp_connect(struct net_context *context,
 		ret = -EPROTONOSUPPORT;
 	}
 
+	if (ret == 0) {
+		tcp_conn_hash_add(conn);
+	}
+
 	if (!(IS_ENABLED(CONFIG_NET_TEST_PROTOCOL) ||
 	      IS_ENABLED(CONFIG_NET_TEST))) {
 		conn->seq = tcp_init_isn(&conn->src.sa, &conn->dst.sa);
@@ -4093,7 +5081,11 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum) {
+	/* The checksum of a super-segment is computed per segment, either
+	 * by net_tcp_gso_send() or by the TSO capable device.
+	 */
+	if (net_pkt_gso_size(pkt) == 0U &&
+	    (net_if_need_calc_tx_checksum(net_pkt_iface(pkt), type) || force_chksum)) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 		net_pkt_set_chksum_done(pkt, true);
 	}
@@ -4101,6 +5093,247 @@ int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 	return net_pkt_set_data(pkt, &tcp_access);
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+/* Position in the payload of a super-segment being split */
+struct tcp_gso_pos {
+	struct net_buf *prev;
+	struct net_buf *frag;
+	size_t offset;
+};
+
+/* Move past len bytes of payload without giving them to any segment */
+static void tcp_gso_skip_payload(struct tcp_gso_pos *pos, size_t len)
+{
+	while (len > 0 && pos->frag) {
+		size_t n = MIN(pos->frag->len - pos->offset, len);
+
+		if (pos->offset + n == pos->frag->len) {
+			pos->prev = pos->frag;
+			pos->frag = pos->frag->frags;
+			pos->offset = 0U;
+		} else {
+			pos->offset += n;
+		}
+
+		len -= n;
+	}
+}
+
+/* Give len bytes of payload to a segment.  Fragments lying wholly in the
+ * segment are moved over from the super-segment, which does not need them
+ * anymore.  Fragments straddling two segments, or shared with the headers,
+ * are cloned, which only references their data if the pool allows it.
+ * This runs with the interface TX lock held so the clone does not wait
+ * for buffers: if none is left, the rest of the segment is skipped and
+ * the segment is dropped, to be recovered by TCP retransmission.
+ */
+static int tcp_gso_take_payload(struct net_pkt *seg, struct tcp_gso_pos *pos,
+				size_t len)
+{
+	while (len > 0) {
+		struct net_buf *frag = pos->frag;
+		size_t avail;
+		size_t n;
+
+		if (!frag) {
+			return -EINVAL;
+		}
+
+		avail = frag->len - pos->offset;
+		n = MIN(avail, len);
+
+		if (pos->offset == 0U && n == avail) {
+			pos->frag = frag->frags;
+			pos->prev->frags = frag->frags;
+			frag->frags = NULL;
+
+			net_pkt_append_buffer(seg, frag);
+			len -= n;
+			continue;
+		}
+
+		frag = net_buf_clone(pos->frag, K_NO_WAIT);
+		if (!frag) {
+			tcp_gso_skip_payload(pos, len);
+			return -ENOBUFS;
+		}
+
+		net_buf_pull(frag, pos->offset);
+		frag->len = n;
+		net_pkt_append_buffer(seg, frag);
+
+		if (n == avail) {
+			pos->prev = pos->frag;
+			pos->frag = pos->frag->frags;
+			pos->offset = 0U;
+		} else {
+			pos->offset += n;
+		}
+
+		len -= n;
+	}
+
+	return 0;
+}
+
+static struct net_pkt *tcp_gso_segment(struct net_pkt *pkt, size_t hdr_len,
+				       struct tcp_gso_pos *pos, size_t len)
+{
+	struct net_pkt *seg;
+
+	/* Only the headers are copied, the payload is attached below.  As
+	 * for the payload, do not wait for buffers under the TX lock.
+	 */
+	seg = net_pkt_alloc_with_buffer(net_pkt_iface(pkt), hdr_len,
+					net_pkt_family(pkt), IPPROTO_TCP,
+					K_NO_WAIT);
+	if (!seg) {
+		tcp_gso_skip_payload(pos, len);
+		return NULL;
+	}
+
+	tp_pkt_alloc(seg, tp_basename(__FILE__), __LINE__);
+
+	net_pkt_set_ll_proto_type(seg, net_pkt_ll_proto_type(pkt));
+	net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+	net_pkt_set_ip_dscp(seg, net_pkt_ip_dscp(pkt));
+	net_pkt_set_ip_ecn(seg, net_pkt_ip_ecn(pkt));
+	net_pkt_set_priority(seg, net_pkt_priority(pkt));
+	net_pkt_set_vlan_tag(seg, net_pkt_vlan_tag(pkt));
+	memcpy(net_pkt_lladdr_src(seg), net_pkt_lladdr_src(pkt),
+	       sizeof(struct net_linkaddr));
+	memcpy(net_pkt_lladdr_dst(seg), net_pkt_lladdr_dst(pkt),
+	       sizeof(struct net_linkaddr));
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		net_pkt_set_ipv4_ttl(seg, net_pkt_ipv4_ttl(pkt));
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		net_pkt_set_ipv6_hop_limit(seg, net_pkt_ipv6_hop_limit(pkt));
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_copy(seg, pkt, hdr_len) < 0) {
+		tcp_gso_skip_payload(pos, len);
+		tcp_pkt_unref(seg);
+		return NULL;
+	}
+
+	net_pkt_trim_buffer(seg);
+
+	if (tcp_gso_take_payload(seg, pos, len) < 0) {
+		tcp_pkt_unref(seg);
+		return NULL;
+	}
+
+	return seg;
+}
+
+/* Find where the payload starts, past hdr_len bytes of headers */
+static int tcp_gso_pos_init(struct net_pkt *pkt, size_t hdr_len,
+			    struct tcp_gso_pos *pos)
+{
+	pos->prev = NULL;
+	pos->frag = pkt->buffer;
+
+	while (pos->frag && hdr_len >= pos->frag->len) {
+		hdr_len -= pos->frag->len;
+		pos->prev = pos->frag;
+		pos->frag = pos->frag->frags;
+	}
+
+	pos->offset = hdr_len;
+
+	return pos->frag ? 0 : -EINVAL;
+}
+
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	uint16_t gso_size = net_pkt_gso_size(pkt);
+	struct tcp_gso_pos pos;
+	struct tcphdr *th;
+	size_t hdr_len;
+	size_t data_len;
+	uint32_t seq;
+	uint8_t flags;
+	int sent = 0;
+
+	th = th_get(pkt);
+	if (!th) {
+		return -ENOBUFS;
+	}
+
+	hdr_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+		  th_off(th) * 4U;
+	data_len = net_pkt_get_len(pkt) - hdr_len;
+	seq = th_seq(th);
+	flags = th_flags(th);
+
+	if (tcp_gso_pos_init(pkt, hdr_len, &pos) < 0) {
+		return -EINVAL;
+	}
+
+	/* The IPv4 header checksum is computed again for each segment */
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		NET_IPV4_HDR(pkt)->chksum = 0U;
+	}
+
+	for (size_t offset = 0; offset < data_len; offset += gso_size) {
+		size_t len = MIN(gso_size, data_len - offset);
+		struct net_pkt *seg;
+		int ret;
+
+		/* A segment lacking buffers is dropped, the peer will not
+		 * acknowledge it and it gets retransmitted.
+		 */
+		seg = tcp_gso_segment(pkt, hdr_len, &pos, len);
+		if (!seg) {
+			NET_DBG("Dropping segment %zu/%zu, no buffers", offset,
+				data_len);
+			continue;
+		}
+
+		th = th_get(seg);
+		if (!th) {
+			NET_DBG("Dropping segment %zu/%zu, no buffers", offset,
+				data_len);
+			tcp_pkt_unref(seg);
+			continue;
+		}
+
+		UNALIGNED_PUT(htonl(seq + offset), &th->th_seq);
+
+		/* Only the last segment gets the push flag */
+		if (offset + len < data_len) {
+			UNALIGNED_PUT((uint8_t)(flags & ~PSH), &th->th_flags);
+		}
+
+		ret = tcp_finalize_pkt(seg);
+		if (ret == 0) {
+			net_pkt_cursor_init(seg);
+			ret = net_if_l2(iface)->send(iface, seg);
+		}
+
+		if (ret < 0) {
+			NET_DBG("Cannot send segment %zu/%zu (%d)", offset,
+				data_len, ret);
+			tcp_pkt_unref(seg);
+			return ret;
+		}
+
+		sent += ret;
+	}
+
+	tcp_pkt_unref(pkt);
+
+	return sent;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 				  struct net_pkt_data_access *tcp_access)
 {
@@ -4147,6 +5380,7 @@ static enum net_verdict tcp_input(struct net_conn *net_conn,
 			conn = context->tcp;
 			tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 			tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+			tcp_conn_hash_add(conn);
 			/* Make an extra reference, the sanity check suite
 			 * will delete the connection explicitly
 			 */
@@ -4271,6 +5505,7 @@ enum net_verdict tp_input(struct net_conn *net_conn,
 				conn = context->tcp;
 				tcp_endpoint_set(&conn->dst, pkt, TCP_EP_SRC);
 				tcp_endpoint_set(&conn->src, pkt, TCP_EP_DST);
+				tcp_conn_hash_add(conn);
 				conn->iface = pkt->iface;
 				tcp_conn_ref(conn);
 			}
@@ -4637,6 +5872,8 @@ void net_tcp_init(void)
 #define THREAD_PRIORITY K_PRIO_PREEMPT(CONFIG_NET_TCP_WORKER_PRIO)
 #endif
 
+	tcp_conns_hash_seed = sys_rand32_get();
+
 	/* Use private workqueue in order not to block the system work queue.
 	 */
 	k_work_queue_start(&tcp_work_q, work_q_stack,
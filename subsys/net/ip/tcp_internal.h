@@ -263,6 +263,41 @@ static inline int net_tcp_finalize(struct net_pkt *pkt, bool force_chksum)
 }
 #endif
 
+/**
+ * @brief Split a TCP super-segment and send the segments to L2
+ *
+ * @param iface Network interface the packet is sent on
+ * @param pkt Network packet with a non-zero GSO size
+ *
+ * Segments which cannot get buffers without waiting are dropped, and
+ * left to TCP retransmission.
+ *
+ * @return Number of bytes sent to L2, negative errno otherwise. The
+ *         packet is released on success, like L2 send would do.
+ */
+#if defined(CONFIG_NET_NATIVE_TCP) && defined(CONFIG_NET_TCP_GSO)
+int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt);
+#else
+static inline int net_tcp_gso_send(struct net_if *iface, struct net_pkt *pkt)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+	return -ENOTSUP;
+}
+#endif
+
+/**
+ * @brief Pass the coalesced TCP segments held back for all connections
+ * to TCP input processing
+ *
+ * This is called by the RX thread when it has no more packets to process.
+ */
+#if defined(CONFIG_NET_NATIVE_TCP) && defined(CONFIG_NET_TCP_GRO)
+void net_tcp_gro_flush(void);
+#else
+static inline void net_tcp_gro_flush(void) { }
+#endif
+
 /**
  * @brief Get pointer to TCP header in net_pkt
  *
@@ -227,20 +227,75 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* At most 4 SACK blocks fit in the 40 bytes of TCP options */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_count;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+#if defined(CONFIG_NET_TCP_SACK)
+	bool sack_perm_found : 1;
+#endif
+};
+
+#if defined(CONFIG_NET_TCP_SACK)
+
+enum tcp_sack_seg_flags {
+	TCP_SACK_SEG_SACKED = BIT(0),	/* selectively acknowledged */
+	TCP_SACK_SEG_LOST = BIT(1),	/* lost, waiting to be retransmitted */
+	TCP_SACK_SEG_RETRANS = BIT(2),	/* retransmitted at least once */
 };
 
+/* Data sent in one go and not cumulatively acknowledged yet */
+struct tcp_sack_seg {
+	uint32_t seq;
+	uint32_t xmit_time; /* in ms, of the latest transmission */
+	uint16_t len;
+	uint8_t flags;
+};
+
+struct tcp_sack_scoreboard {
+	struct tcp_sack_seg segs[CONFIG_NET_TCP_SACK_SEGMENTS];
+	uint8_t count;
+	/* RACK state, see RFC 8985 */
+	uint32_t rack_xmit_time;
+	uint32_t rack_end_seq;
+	uint32_t rack_rtt;
+	uint32_t min_rtt;
+	uint32_t srtt;
+	uint32_t recovery_point;
+	uint32_t tlp_end_seq;
+	bool rack_valid : 1;
+	bool rtt_valid : 1;
+	bool reord : 1;
+	bool in_recovery : 1;
+	bool tlp_armed : 1;
+	bool tlp_in_flight : 1;
+};
+#endif /* CONFIG_NET_TCP_SACK */
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
 struct tcp_collision_avoidance_reno {
@@ -255,6 +310,12 @@ typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
 struct tcp { /* TCP connection */
 	sys_snode_t next;
+	sys_snode_t hash_next; /* node in the lookup table */
+#if defined(CONFIG_NET_TCP_GRO)
+	sys_snode_t gro_next; /* node in the list of connections holding data */
+	struct net_pkt *gro_pkt; /* coalesced segments not yet processed */
+	uint32_t gro_seq; /* sequence number extending gro_pkt */
+#endif
 	struct net_context *context;
 	struct net_pkt *send_data;
 	struct net_pkt *queue_recv_data;
@@ -285,6 +346,10 @@ struct tcp { /* TCP connection */
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 	struct k_work_delayable keepalive_timer;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
+#if defined(CONFIG_NET_TCP_SACK)
+	struct k_work_delayable rack_timer; /* RACK reordering and TLP timer */
+	struct tcp_sack_scoreboard sack;
+#endif
 	struct k_work conn_release;
 
 	union {
@@ -60,6 +60,7 @@ static struct ethernet_capabilities eth_hw_caps[] = {
 	EC(ETHERNET_TXINJECTION_MODE,     "TX-Injection supported"),
 	EC(ETHERNET_LINK_2500BASE_T,      "2.5 Gbits"),
 	EC(ETHERNET_LINK_5000BASE_T,      "5 Gbits"),
+	EC(ETHERNET_HW_TSO,               "TCP segmentation offload"),
 };
 
 static void print_supported_ethernet_capabilities(
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+static int cmd_kernel_ipi(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct k_ipi_stats stats;
+	unsigned int num_cpus = arch_num_cpus();
+
+	shell_print(sh, "CPU       sent     useful   spurious");
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		(void)k_ipi_stats_get(i, &stats);
+		shell_print(sh, "%3u %10u %10u %10u", i, stats.sent, stats.useful,
+			    stats.spurious);
+	}
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(ipi, NULL, "Scheduler IPI statistics.", cmd_kernel_ipi);
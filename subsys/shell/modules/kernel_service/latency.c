@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+static void latency_print(const struct shell *sh, const char *name,
+			  const struct k_ready_latency_stats *stats)
+{
+	char line[16 * CONFIG_SCHED_THREAD_READY_LATENCY_BUCKETS];
+	int len = 0;
+
+	shell_print(sh, "%-20s %10u %10u %10u", name, stats->count,
+		    (stats->count != 0U) ? (uint32_t)(stats->total / stats->count) : 0U,
+		    stats->longest);
+
+	/* Only the populated buckets, as "<log2 of the lower bound>:<count>" */
+	line[0] = '\0';
+	for (unsigned int i = 0; i < CONFIG_SCHED_THREAD_READY_LATENCY_BUCKETS; i++) {
+		if ((stats->buckets[i] != 0U) && (len < (int)sizeof(line))) {
+			len += snprintk(&line[len], sizeof(line) - len, " %u:%u", i,
+					stats->buckets[i]);
+		}
+	}
+
+	if (len != 0) {
+		shell_print(sh, "\t%s", line);
+	}
+}
+
+static void thread_latency_print(const struct k_thread *cthread, void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *sh = (const struct shell *)user_data;
+	k_thread_runtime_stats_t stats;
+	const char *tname = k_thread_name_get(thread);
+	char name[21];
+
+	if (k_thread_runtime_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	if (tname == NULL) {
+		snprintk(name, sizeof(name), "%p", thread);
+		tname = name;
+	}
+
+	latency_print(sh, tname, &stats.ready_latency);
+}
+
+static int cmd_kernel_latency(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	k_thread_runtime_stats_t stats;
+	unsigned int num_cpus = arch_num_cpus();
+	char name[8];
+
+	shell_print(sh, "Ready-to-run latency (cycles), histogram buckets as log2:count");
+	shell_print(sh, "%-20s %10s %10s %10s", "", "count", "average", "longest");
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		(void)k_thread_runtime_stats_cpu_get(i, &stats);
+		snprintk(name, sizeof(name), "CPU %u", i);
+		latency_print(sh, name, &stats.ready_latency);
+	}
+
+	/*
+	 * Use the unlocked version as the callback itself might call
+	 * arch_irq_unlock.
+	 */
+	k_thread_foreach_unlocked(thread_latency_print, (void *)sh);
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(latency, NULL, "Ready-to-run latency statistics.", cmd_kernel_latency);
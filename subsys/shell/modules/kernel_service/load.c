@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <zephyr/kernel.h>
+
+static int cmd_kernel_load(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	struct k_cpu_load_stats stats;
+	unsigned int num_cpus = arch_num_cpus();
+
+	shell_print(sh, "CPU      1s      10s      60s");
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		(void)k_cpu_load_get(i, &stats);
+		shell_print(sh, "%3u %5u.%u%% %5u.%u%% %5u.%u%%", i,
+			    stats.avg_1s / 10U, stats.avg_1s % 10U,
+			    stats.avg_10s / 10U, stats.avg_10s % 10U,
+			    stats.avg_60s / 10U, stats.avg_60s % 10U);
+	}
+
+	return 0;
+}
+
+KERNEL_CMD_ADD(load, NULL, "CPU load averages.", cmd_kernel_load);
@@ -543,6 +543,10 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_pipe_read_enter(pipe, data, len, timeout)
 #define sys_port_trace_k_pipe_read_blocking(pipe, timeout)
 #define sys_port_trace_k_pipe_read_exit(pipe, ret)
+#define sys_port_trace_k_pipe_writev_enter(pipe, iov, iovcnt, timeout)
+#define sys_port_trace_k_pipe_writev_exit(pipe, ret)
+#define sys_port_trace_k_pipe_readv_enter(pipe, iov, iovcnt, timeout)
+#define sys_port_trace_k_pipe_readv_exit(pipe, ret)
 
 #define sys_port_trace_k_pipe_cleanup_enter(pipe)
 #define sys_port_trace_k_pipe_cleanup_exit(pipe, ret)
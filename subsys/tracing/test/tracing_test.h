@@ -359,6 +359,14 @@
 	sys_trace_k_pipe_read_blocking(pipe, timeout)
 #define sys_port_trace_k_pipe_read_exit(pipe, ret) \
 	sys_trace_k_pipe_read_exit(pipe, ret)
+#define sys_port_trace_k_pipe_writev_enter(pipe, iov, iovcnt, timeout) \
+	sys_trace_k_pipe_writev_enter(pipe, iov, iovcnt, timeout)
+#define sys_port_trace_k_pipe_writev_exit(pipe, ret) \
+	sys_trace_k_pipe_writev_exit(pipe, ret)
+#define sys_port_trace_k_pipe_readv_enter(pipe, iov, iovcnt, timeout) \
+	sys_trace_k_pipe_readv_enter(pipe, iov, iovcnt, timeout)
+#define sys_port_trace_k_pipe_readv_exit(pipe, ret) \
+	sys_trace_k_pipe_readv_exit(pipe, ret)
 
 #define sys_port_trace_k_pipe_cleanup_enter(pipe) sys_trace_k_pipe_cleanup_enter(pipe)
 #define sys_port_trace_k_pipe_cleanup_exit(pipe, ret) sys_trace_k_pipe_cleanup_exit(pipe, ret)
@@ -651,6 +659,12 @@ void sys_trace_k_pipe_read_enter(struct k_pipe *pipe, const void *data, size_t l
 				 k_timeout_t timeout);
 void sys_trace_k_pipe_read_blocking(struct k_pipe *pipe, k_timeout_t timeout);
 void sys_trace_k_pipe_read_exit(struct k_pipe *pipe, int ret);
+void sys_trace_k_pipe_writev_enter(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+				   size_t iovcnt, k_timeout_t timeout);
+void sys_trace_k_pipe_writev_exit(struct k_pipe *pipe, int ret);
+void sys_trace_k_pipe_readv_enter(struct k_pipe *pipe, const struct k_pipe_iovec *iov,
+				  size_t iovcnt, k_timeout_t timeout);
+void sys_trace_k_pipe_readv_exit(struct k_pipe *pipe, int ret);
 
 void sys_trace_k_pipe_cleanup_enter(struct k_pipe *pipe);
 void sys_trace_k_pipe_cleanup_exit(struct k_pipe *pipe, int ret);
@@ -0,0 +1,147 @@
+/* fifo_b.c */
+
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "master.h"
+#include <zephyr/kernel.h>
+
+#define FIFO_MAX_PRODUCERS MAX(CONFIG_MP_MAX_NUM_CPUS, 2)
+#define FIFO_STACK_SIZE    (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct fifo_item {
+	void *fifo_reserved;
+	uint32_t seq;
+};
+
+static struct fifo_item fifo_items[NR_OF_FIFO_RUNS];
+
+K_FIFO_DEFINE(BENCH_FIFO);
+
+static struct k_thread fifo_threads[2 * FIFO_MAX_PRODUCERS];
+static K_THREAD_STACK_ARRAY_DEFINE(fifo_stacks, 2 * FIFO_MAX_PRODUCERS,
+				   FIFO_STACK_SIZE);
+
+static atomic_t fifo_consumed;
+static unsigned int fifo_producers;
+
+static void fifo_producer(void *p1, void *p2, void *p3)
+{
+	unsigned int id = (unsigned int)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (unsigned int i = id; i < NR_OF_FIFO_RUNS; i += fifo_producers) {
+		k_fifo_put(&BENCH_FIFO, &fifo_items[i]);
+	}
+}
+
+static void fifo_consumer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* Non-blocking consumer: poll the FIFO until everything is in */
+	while (atomic_get(&fifo_consumed) < NR_OF_FIFO_RUNS) {
+		if (k_fifo_get(&BENCH_FIFO, K_NO_WAIT) != NULL) {
+			atomic_inc(&fifo_consumed);
+		} else {
+			k_yield();
+		}
+	}
+}
+
+/**
+ * @brief Run @a n producers against @a n consumers
+ *
+ * @return Elapsed time in cycles
+ */
+static uint32_t fifo_mpmc(unsigned int n)
+{
+	int priority = k_thread_priority_get(k_current_get());
+	timing_t start;
+	timing_t end;
+
+	atomic_clear(&fifo_consumed);
+	fifo_producers = n;
+
+	for (unsigned int i = 0; i < 2 * n; i++) {
+		k_thread_create(&fifo_threads[i], fifo_stacks[i],
+				FIFO_STACK_SIZE,
+				(i < n) ? fifo_producer : fifo_consumer,
+				(void *)(uintptr_t)i, NULL, NULL,
+				priority, 0, K_FOREVER);
+	}
+
+	start = timing_timestamp_get();
+
+	for (unsigned int i = 0; i < 2 * n; i++) {
+		k_thread_start(&fifo_threads[i]);
+	}
+
+	for (unsigned int i = 0; i < 2 * n; i++) {
+		k_thread_join(&fifo_threads[i], K_FOREVER);
+	}
+
+	end = timing_timestamp_get();
+
+	return (uint32_t)timing_cycles_get(&start, &end);
+}
+
+/**
+ * @brief FIFO put/get test
+ */
+void fifo_test(void)
+{
+	uint32_t et; /* elapsed time */
+	timing_t  start;
+	timing_t  end;
+	char descr[64];
+	int i;
+
+	PRINT_STRING(dashline);
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_FIFO_RUNS; i++) {
+		k_fifo_put(&BENCH_FIFO, &fifo_items[i]);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "put item in FIFO, no waiters",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_FIFO_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_FIFO_RUNS; i++) {
+		(void)k_fifo_get(&BENCH_FIFO, K_NO_WAIT);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "get item from FIFO",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_FIFO_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_FIFO_RUNS; i++) {
+		(void)k_fifo_get(&BENCH_FIFO, K_NO_WAIT);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "poll empty FIFO",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_FIFO_RUNS));
+
+	et = fifo_mpmc(1);
+	PRINT_F(FORMAT, "put and get item, 1 producer 1 consumer",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_FIFO_RUNS));
+
+	et = fifo_mpmc(FIFO_MAX_PRODUCERS);
+	snprintf(descr, sizeof(descr), "put and get item, %d producers %d consumers",
+		 FIFO_MAX_PRODUCERS, FIFO_MAX_PRODUCERS);
+	PRINT_F(FORMAT, descr,
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_FIFO_RUNS));
+}
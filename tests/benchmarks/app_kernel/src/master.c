@@ -120,6 +120,12 @@ static void test_thread_entry(void *p1, void *p2, void *p3)
 #endif
 	PRINT_STRING(dashline);
 
+	/* Only the FIFO test is meaningful with more than one CPU */
+	if (arch_num_cpus() > 1) {
+		fifo_test();
+		return;
+	}
+
 	message_queue_test();
 	sema_test();
 	mutex_test();
@@ -130,6 +136,10 @@ static void test_thread_entry(void *p1, void *p2, void *p3)
 	}
 
 	pipe_test();
+
+	if (!skip_mem_and_mbox) {
+		fifo_test();
+	}
 }
 
 /**
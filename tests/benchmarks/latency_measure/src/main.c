@@ -48,6 +48,7 @@ extern void thread_switch_yield(uint32_t num_iterations, bool is_cooperative);
 extern void int_to_thread(uint32_t num_iterations);
 extern void sema_test_signal(uint32_t num_iterations, uint32_t options);
 extern void mutex_lock_unlock(uint32_t num_iterations, uint32_t options);
+extern int sys_mutex_lock_unlock(uint32_t num_iterations, uint32_t options);
 extern void sema_context_switch(uint32_t num_iterations,
 				uint32_t start_options, uint32_t alt_options);
 extern int thread_ops(uint32_t num_iterations, uint32_t start_options,
@@ -201,6 +202,11 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 	mutex_lock_unlock(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
 #endif
 
+	sys_mutex_lock_unlock(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
+#ifdef CONFIG_USERSPACE
+	sys_mutex_lock_unlock(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
+#endif
+
 	heap_malloc_free();
 
 	TC_END_REPORT(error_count);
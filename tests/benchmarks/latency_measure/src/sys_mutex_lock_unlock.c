@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for sys_mutex lock and unlock
+ *
+ * This file contains the test that measures sys_mutex lock and unlock times.
+ * There is no contention on the mutex being tested, so with
+ * CONFIG_SYS_MUTEX_FUTEX user threads are expected to lock and unlock it
+ * without making any system call.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/mutex.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+static BENCH_BMEM SYS_MUTEX_DEFINE(test_sys_mutex);
+
+static BENCH_BMEM uint64_t pair_cycles;
+
+static void start_lock_unlock(void *p1, void *p2, void *p3)
+{
+	uint32_t  i;
+	uint32_t  num_iterations = (uint32_t)(uintptr_t)p1;
+	timing_t  start;
+	timing_t  finish;
+	uint64_t  lock_cycles;
+	uint64_t  unlock_cycles;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* Lock and unlock the free mutex */
+
+	start = timing_timestamp_get();
+
+	for (i = 0; i < num_iterations; i++) {
+		sys_mutex_lock(&test_sys_mutex, K_NO_WAIT);
+		sys_mutex_unlock(&test_sys_mutex);
+	}
+
+	finish = timing_timestamp_get();
+
+	pair_cycles = timing_cycles_get(&start, &finish);
+
+	start = timing_timestamp_get();
+
+	/* Recursively lock take the mutex */
+
+	for (i = 0; i < num_iterations; i++) {
+		sys_mutex_lock(&test_sys_mutex, K_NO_WAIT);
+	}
+
+	finish = timing_timestamp_get();
+
+	lock_cycles = timing_cycles_get(&start, &finish);
+
+	start = timing_timestamp_get();
+
+	/* Recursively unlock the mutex */
+
+	for (i = 0; i < num_iterations; i++) {
+		sys_mutex_unlock(&test_sys_mutex);
+	}
+
+	finish = timing_timestamp_get();
+
+	unlock_cycles = timing_cycles_get(&start, &finish);
+
+	timestamp.cycles = lock_cycles;
+	k_sem_take(&pause_sem, K_FOREVER);
+
+	timestamp.cycles = unlock_cycles;
+}
+
+/**
+ *
+ * @brief Test for the sys_mutex lock/unlock time
+ *
+ * The routine locks and unlocks a free sys_mutex, then performs multiple
+ * recursive locks followed by multiple unlocks to measure the necessary
+ * time.
+ *
+ * @return 0 on success
+ */
+int sys_mutex_lock_unlock(uint32_t num_iterations, uint32_t options)
+{
+	char tag[50];
+	char description[120];
+	const char *ctx = (options & K_USER) == K_USER ? "user" : "kernel";
+	int  priority;
+	uint64_t  cycles;
+
+	timing_start();
+
+	priority = k_thread_priority_get(k_current_get());
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			start_lock_unlock,
+			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			priority - 1, options, K_FOREVER);
+
+	k_thread_access_grant(&start_thread, &pause_sem);
+	k_thread_start(&start_thread);
+
+	snprintf(tag, sizeof(tag), "sys_mutex.lock+unlock.immediate.%s", ctx);
+	snprintf(description, sizeof(description),
+		 "%-40s - Lock then unlock a sys_mutex", tag);
+	PRINT_STATS_AVG(description, (uint32_t)pair_cycles, num_iterations,
+			false, "");
+
+	cycles = timestamp.cycles;
+	k_sem_give(&pause_sem);
+
+	snprintf(tag, sizeof(tag), "sys_mutex.lock.immediate.recursive.%s", ctx);
+	snprintf(description, sizeof(description),
+		 "%-40s - Lock a sys_mutex", tag);
+	PRINT_STATS_AVG(description, (uint32_t)cycles, num_iterations,
+			false, "");
+
+	cycles = timestamp.cycles;
+
+	snprintf(tag, sizeof(tag), "sys_mutex.unlock.immediate.recursive.%s", ctx);
+	snprintf(description, sizeof(description),
+		 "%-40s - Unlock a sys_mutex", tag);
+	PRINT_STATS_AVG(description, (uint32_t)cycles, num_iterations,
+			false, "");
+
+	timing_stop();
+	return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the time to map and unmap large
+ * regions of anonymous memory with k_mem_map() and k_mem_unmap(), one page
+ * frame at a time, compared against one run of physically contiguous page
+ * frames with K_MEM_MAP_CONTIG.
+ *
+ * The regions are not zeroed, so only the page frame allocation and the
+ * page table updates are measured.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/mm.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define MAX_REGION_SIZE (CONFIG_BENCHMARK_MAX_REGION_SIZE_MB * MB(1))
+
+enum map_mode {
+	MAP_PAGES,
+	MAP_CONTIG,
+	MAP_NUM_MODES,
+};
+
+static const char *const mode_names[MAP_NUM_MODES] = {
+	[MAP_PAGES] = "pages",
+	[MAP_CONTIG] = "contig",
+};
+
+static const uint32_t mode_flags[MAP_NUM_MODES] = {
+	[MAP_PAGES] = K_MEM_PERM_RW | K_MEM_MAP_UNINIT | K_MEM_MAP_LOCK,
+	[MAP_CONTIG] = K_MEM_PERM_RW | K_MEM_MAP_UNINIT | K_MEM_MAP_CONTIG,
+};
+
+static void report(const char *tag, const char *str, uint64_t cycles,
+		   uint32_t count)
+{
+	uint64_t average = cycles / count;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static bool test_map(enum map_mode mode, size_t size)
+{
+	const char *name = mode_names[mode];
+	uint64_t map_cycles = 0;
+	uint64_t unmap_cycles = 0;
+	timing_t start;
+	timing_t finish;
+	uint8_t *region;
+	char tag[50];
+	char description[120];
+
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		region = k_mem_map(size, mode_flags[mode]);
+		finish = timing_counter_get();
+
+		if (region == NULL) {
+			printk("FAIL: %s mapping of %zu MB\n", name, size / MB(1));
+			return false;
+		}
+		map_cycles += timing_cycles_get(&start, &finish);
+
+		/* Touch both ends of the region */
+		region[0] = (uint8_t)i;
+		region[size - 1] = (uint8_t)i;
+
+		start = timing_counter_get();
+		k_mem_unmap(region, size);
+		finish = timing_counter_get();
+		unmap_cycles += timing_cycles_get(&start, &finish);
+	}
+
+	snprintf(tag, sizeof(tag), "mem_map.%s.map.%zu_MB", name, size / MB(1));
+	snprintf(description, sizeof(description),
+		 "%s, map a %zu MB region", name, size / MB(1));
+	report(tag, description, map_cycles, CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	snprintf(tag, sizeof(tag), "mem_map.%s.unmap.%zu_MB", name, size / MB(1));
+	snprintf(description, sizeof(description),
+		 "%s, unmap a %zu MB region", name, size / MB(1));
+	report(tag, description, unmap_cycles, CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	return true;
+}
+
+int main(void)
+{
+	unsigned int freq;
+	int status = TC_PASS;
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for page by page vs. contiguous memory mappings\n");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+	printk("Free memory: %zu KB\n", k_mem_free_get() / 1024);
+
+	timing_start();
+
+	for (size_t size = MB(1); size <= MAX_REGION_SIZE; size *= 4) {
+		if (size > k_mem_free_get()) {
+			printk("Skipping %zu MB regions: not enough free memory\n",
+			       size / MB(1));
+			break;
+		}
+
+		for (enum map_mode mode = MAP_PAGES; mode < MAP_NUM_MODES; mode++) {
+			if (!test_map(mode, size)) {
+				status = TC_FAIL;
+			}
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure k_mem_slab_alloc() and
+ * k_mem_slab_free() throughput when one worker thread per CPU hammers
+ * the same slab, compared against a single worker.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define MAX_WORKERS  CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define BLOCK_SIZE   32
+#define NUM_BLOCKS   (MAX_WORKERS * (CONFIG_BENCHMARK_BURST + 16))
+
+K_MEM_SLAB_DEFINE_STATIC(bench_slab, BLOCK_SIZE, NUM_BLOCKS, sizeof(void *));
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_WORKERS, STACK_SIZE);
+static struct k_thread threads[MAX_WORKERS];
+static K_SEM_DEFINE(done_sem, 0, MAX_WORKERS);
+
+static uint64_t worker_cycles[MAX_WORKERS];
+static bool worker_failed[MAX_WORKERS];
+
+static void report(const char *tag, const char *str, uint64_t cycles,
+		   uint32_t count)
+{
+	uint64_t average = cycles / count;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	uintptr_t id = (uintptr_t)p1;
+	void *blocks[CONFIG_BENCHMARK_BURST];
+	timing_t start;
+	timing_t finish;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	start = timing_counter_get();
+
+	for (unsigned int iter = 0; iter < CONFIG_BENCHMARK_NUM_ITERATIONS; iter++) {
+		for (unsigned int i = 0; i < CONFIG_BENCHMARK_BURST; i++) {
+			if (k_mem_slab_alloc(&bench_slab, &blocks[i], K_NO_WAIT) != 0) {
+				worker_failed[id] = true;
+				blocks[i] = NULL;
+			}
+		}
+
+		for (unsigned int i = 0; i < CONFIG_BENCHMARK_BURST; i++) {
+			if (blocks[i] != NULL) {
+				k_mem_slab_free(&bench_slab, blocks[i]);
+			}
+		}
+	}
+
+	finish = timing_counter_get();
+
+	worker_cycles[id] = timing_cycles_get(&start, &finish);
+
+	k_sem_give(&done_sem);
+}
+
+static bool test_workers(unsigned int num_workers)
+{
+	const uint32_t ops = CONFIG_BENCHMARK_NUM_ITERATIONS * CONFIG_BENCHMARK_BURST;
+	timing_t start;
+	timing_t finish;
+	uint64_t per_worker = 0ULL;
+	bool failed = false;
+	char tag[50];
+	char description[120];
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		worker_failed[i] = false;
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, worker,
+				(void *)(uintptr_t)i, NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_FOREVER);
+	}
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		per_worker += worker_cycles[i];
+		failed |= worker_failed[i];
+	}
+
+	if (failed || (k_mem_slab_num_used_get(&bench_slab) != 0U)) {
+		printk("FAIL: slab exhausted or leaked blocks with %u workers\n",
+		       num_workers);
+		return false;
+	}
+
+	snprintf(tag, sizeof(tag), "mem_slab.alloc_free.%u_workers", num_workers);
+	snprintf(description, sizeof(description),
+		 "%u worker(s), alloc + free per worker", num_workers);
+	report(tag, description, per_worker, ops * num_workers);
+
+	snprintf(tag, sizeof(tag), "mem_slab.throughput.%u_workers", num_workers);
+	snprintf(description, sizeof(description),
+		 "%u worker(s), wall time per alloc + free", num_workers);
+	report(tag, description, timing_cycles_get(&start, &finish),
+	       ops * num_workers);
+
+	return true;
+}
+
+int main(void)
+{
+	unsigned int freq;
+	int status = TC_PASS;
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for memory slab%s on %u CPU(s)\n",
+	       IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ? " with per-CPU cache" : "",
+	       arch_num_cpus());
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	if (!test_workers(1)) {
+		status = TC_FAIL;
+	}
+
+	if ((arch_num_cpus() > 1) && !test_workers(arch_num_cpus())) {
+		status = TC_FAIL;
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the time to send and receive a
+ * message through a k_msgq, copying it in and out with k_msgq_put() and
+ * k_msgq_get(), compared against writing and reading it in place with
+ * k_msgq_reserve()/k_msgq_commit() and k_msgq_claim()/k_msgq_release().
+ *
+ * With CONFIG_USERSPACE the messages are sent and received by a user mode
+ * thread, so the cost of the system calls is included.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/app_memory/app_memdomain.h>
+#include <stdio.h>
+
+#define MAX_MSG_SIZE CONFIG_BENCHMARK_MAX_MSG_SIZE
+#define NUM_MSGS     4
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#ifdef CONFIG_USERSPACE
+K_APPMEM_PARTITION_DEFINE(bench_partition);
+#define BENCH_BMEM K_APP_BMEM(bench_partition)
+#define WORKER_OPTIONS (K_USER | K_INHERIT_PERMS)
+static struct k_mem_domain bench_domain;
+#else
+#define BENCH_BMEM
+#define WORKER_OPTIONS 0
+#endif /* CONFIG_USERSPACE */
+
+enum xfer_mode {
+	XFER_COPY,
+	XFER_ZERO_COPY,
+};
+
+static struct k_msgq bench_msgq;
+
+BENCH_BMEM static uint32_t __aligned(8) ring[(MAX_MSG_SIZE / 4) * NUM_MSGS];
+BENCH_BMEM static uint32_t __aligned(8) tx_frame[MAX_MSG_SIZE / 4];
+BENCH_BMEM static uint32_t __aligned(8) rx_frame[MAX_MSG_SIZE / 4];
+BENCH_BMEM static bool worker_failed;
+
+static K_THREAD_STACK_DEFINE(worker_stack, STACK_SIZE);
+static struct k_thread worker_thread;
+
+static void report(const char *tag, const char *str, uint64_t cycles,
+		   uint32_t count)
+{
+	uint64_t average = cycles / count;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+/* Stand-ins for a driver filling in a frame and a consumer reading it */
+static void fill_frame(uint32_t *frame, size_t size, uint32_t seq)
+{
+	for (size_t i = 0; i < size / 4; i++) {
+		frame[i] = seq + i;
+	}
+}
+
+static bool check_frame(const uint32_t *frame, size_t size, uint32_t seq)
+{
+	return (frame[0] == seq) && (frame[(size / 4) - 1] == seq + (size / 4) - 1);
+}
+
+static bool xfer_copy(size_t size, uint32_t seq)
+{
+	fill_frame(tx_frame, size, seq);
+
+	if ((k_msgq_put(&bench_msgq, tx_frame, K_NO_WAIT) != 0) ||
+	    (k_msgq_get(&bench_msgq, rx_frame, K_NO_WAIT) != 0)) {
+		return false;
+	}
+
+	return check_frame(rx_frame, size, seq);
+}
+
+static bool xfer_zero_copy(size_t size, uint32_t seq)
+{
+	uint32_t *slot;
+	bool ok;
+
+	if (k_msgq_reserve(&bench_msgq, (void **)&slot, K_NO_WAIT) != 0) {
+		return false;
+	}
+	fill_frame(slot, size, seq);
+	(void)k_msgq_commit(&bench_msgq, slot);
+
+	if (k_msgq_claim(&bench_msgq, (void **)&slot, K_NO_WAIT) != 0) {
+		return false;
+	}
+	ok = check_frame(slot, size, seq);
+	(void)k_msgq_release(&bench_msgq, slot);
+
+	return ok;
+}
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	enum xfer_mode mode = (enum xfer_mode)(uintptr_t)p1;
+	size_t size = (size_t)(uintptr_t)p2;
+
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		bool ok = (mode == XFER_COPY) ? xfer_copy(size, i) :
+						xfer_zero_copy(size, i);
+
+		if (!ok) {
+			worker_failed = true;
+			return;
+		}
+	}
+}
+
+static bool test_xfer(enum xfer_mode mode, size_t size)
+{
+	const char *name = (mode == XFER_COPY) ? "copy" : "zero_copy";
+	timing_t start;
+	timing_t finish;
+	char tag[50];
+	char description[120];
+
+	k_msgq_init(&bench_msgq, (char *)ring, size, NUM_MSGS);
+	worker_failed = false;
+
+	k_thread_create(&worker_thread, worker_stack, STACK_SIZE, worker,
+			(void *)(uintptr_t)mode, (void *)(uintptr_t)size, NULL,
+			K_PRIO_PREEMPT(5), WORKER_OPTIONS, K_FOREVER);
+#ifdef CONFIG_USERSPACE
+	k_mem_domain_add_thread(&bench_domain, &worker_thread);
+	k_thread_access_grant(&worker_thread, &bench_msgq);
+#endif /* CONFIG_USERSPACE */
+
+	start = timing_counter_get();
+	k_thread_start(&worker_thread);
+	k_thread_join(&worker_thread, K_FOREVER);
+	finish = timing_counter_get();
+
+	if (worker_failed) {
+		printk("FAIL: %s transfer of %zu byte messages\n", name, size);
+		return false;
+	}
+
+	snprintf(tag, sizeof(tag), "msgq.%s.%zu_bytes", name, size);
+	snprintf(description, sizeof(description),
+		 "%s, send + receive one %zu byte message", name, size);
+	report(tag, description, timing_cycles_get(&start, &finish),
+	       CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	return true;
+}
+
+int main(void)
+{
+	unsigned int freq;
+	int status = TC_PASS;
+
+#ifdef CONFIG_USERSPACE
+	struct k_mem_partition *parts[] = { &bench_partition };
+
+	if (k_mem_domain_init(&bench_domain, ARRAY_SIZE(parts), parts) != 0) {
+		printk("FAIL: k_mem_domain_init\n");
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+#endif /* CONFIG_USERSPACE */
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for message queue copy vs. zero-copy (%s)\n",
+	       IS_ENABLED(CONFIG_USERSPACE) ? "user mode" : "kernel mode");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	for (size_t size = 64; size <= MAX_MSG_SIZE; size = (size < 512) ? 512 : size * 2) {
+		if (!test_xfer(XFER_COPY, size) || !test_xfer(XFER_ZERO_COPY, size)) {
+			status = TC_FAIL;
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the time to write a chunk made of a
+ * header and a payload to a k_pipe and read it back: gathered into one buffer
+ * and copied with k_pipe_write() and k_pipe_read(), written and read as two
+ * buffers with k_pipe_writev() and k_pipe_readv(), and produced and consumed
+ * in the pipe's ring buffer with the claim/finish calls.
+ *
+ * With CONFIG_USERSPACE the chunks are written and read by a user mode
+ * thread, so the cost of the system calls is included.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/app_memory/app_memdomain.h>
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_CHUNK_SIZE CONFIG_BENCHMARK_MAX_CHUNK_SIZE
+#define HEADER_SIZE    16
+#define STACK_SIZE     (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#ifdef CONFIG_USERSPACE
+K_APPMEM_PARTITION_DEFINE(bench_partition);
+#define BENCH_BMEM K_APP_BMEM(bench_partition)
+#define WORKER_OPTIONS (K_USER | K_INHERIT_PERMS)
+static struct k_mem_domain bench_domain;
+#else
+#define BENCH_BMEM
+#define WORKER_OPTIONS 0
+#endif /* CONFIG_USERSPACE */
+
+enum xfer_mode {
+	XFER_COPY,
+	XFER_IOVEC,
+	XFER_ZERO_COPY,
+	XFER_NUM_MODES,
+};
+
+static const char *const mode_names[XFER_NUM_MODES] = {
+	[XFER_COPY] = "copy",
+	[XFER_IOVEC] = "iovec",
+	[XFER_ZERO_COPY] = "zero_copy",
+};
+
+static struct k_pipe bench_pipe;
+
+BENCH_BMEM static uint8_t __aligned(8) ring[MAX_CHUNK_SIZE];
+BENCH_BMEM static uint8_t __aligned(8) tx_header[HEADER_SIZE];
+BENCH_BMEM static uint8_t __aligned(8) tx_payload[MAX_CHUNK_SIZE - HEADER_SIZE];
+BENCH_BMEM static uint8_t __aligned(8) rx_header[HEADER_SIZE];
+BENCH_BMEM static uint8_t __aligned(8) rx_payload[MAX_CHUNK_SIZE - HEADER_SIZE];
+BENCH_BMEM static uint8_t __aligned(8) staging[MAX_CHUNK_SIZE];
+BENCH_BMEM static bool worker_failed;
+
+static K_THREAD_STACK_DEFINE(worker_stack, STACK_SIZE);
+static struct k_thread worker_thread;
+
+static void report(const char *tag, const char *str, uint64_t cycles,
+		   uint32_t count, size_t size)
+{
+	uint64_t average = cycles / count;
+	uint64_t ns = timing_cycles_to_ns(average);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	ARG_UNUSED(size);
+
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, (uint32_t)ns);
+#else
+	/* throughput of the chunk size at the average time per chunk */
+	uint64_t kib_per_sec = (ns != 0ULL) ? (size * 1000000000ULL) / (ns * 1024ULL) : 0ULL;
+
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec, %7u KiB/s)\n", str, average,
+	       (uint32_t)ns, (uint32_t)kib_per_sec);
+#endif
+}
+
+/* Stand-ins for a producer filling in a chunk and a consumer checking it */
+static void fill_chunk(uint8_t *header, uint8_t *payload, size_t payload_size,
+		       uint8_t seq)
+{
+	memset(header, seq, HEADER_SIZE);
+	memset(payload, seq ^ 0xa5, payload_size);
+}
+
+static bool check_chunk(const uint8_t *header, const uint8_t *payload,
+			size_t payload_size, uint8_t seq)
+{
+	return (header[0] == seq) && (header[HEADER_SIZE - 1] == seq) &&
+	       (payload[0] == (seq ^ 0xa5)) && (payload[payload_size - 1] == (seq ^ 0xa5));
+}
+
+static bool xfer_copy(size_t size, uint8_t seq)
+{
+	size_t payload_size = size - HEADER_SIZE;
+
+	fill_chunk(tx_header, tx_payload, payload_size, seq);
+
+	/* gather the chunk, then copy it through the pipe */
+	memcpy(staging, tx_header, HEADER_SIZE);
+	memcpy(&staging[HEADER_SIZE], tx_payload, payload_size);
+	if ((k_pipe_write(&bench_pipe, staging, size, K_NO_WAIT) != (int)size) ||
+	    (k_pipe_read(&bench_pipe, staging, size, K_NO_WAIT) != (int)size)) {
+		return false;
+	}
+	memcpy(rx_header, staging, HEADER_SIZE);
+	memcpy(rx_payload, &staging[HEADER_SIZE], payload_size);
+
+	return check_chunk(rx_header, rx_payload, payload_size, seq);
+}
+
+static bool xfer_iovec(size_t size, uint8_t seq)
+{
+	size_t payload_size = size - HEADER_SIZE;
+	struct k_pipe_iovec tx_iov[] = {
+		{ tx_header, HEADER_SIZE },
+		{ tx_payload, payload_size },
+	};
+	struct k_pipe_iovec rx_iov[] = {
+		{ rx_header, HEADER_SIZE },
+		{ rx_payload, payload_size },
+	};
+
+	fill_chunk(tx_header, tx_payload, payload_size, seq);
+
+	if ((k_pipe_writev(&bench_pipe, tx_iov, ARRAY_SIZE(tx_iov), K_NO_WAIT) != (int)size) ||
+	    (k_pipe_readv(&bench_pipe, rx_iov, ARRAY_SIZE(rx_iov), K_NO_WAIT) != (int)size)) {
+		return false;
+	}
+
+	return check_chunk(rx_header, rx_payload, payload_size, seq);
+}
+
+static bool xfer_zero_copy(size_t size, uint8_t seq)
+{
+	size_t payload_size = size - HEADER_SIZE;
+	uint8_t *data;
+	bool ok;
+
+	/* chunks evenly divide the ring buffer, so claims never wrap */
+	if (k_pipe_write_claim(&bench_pipe, &data, size, K_NO_WAIT) != (int)size) {
+		return false;
+	}
+	fill_chunk(data, &data[HEADER_SIZE], payload_size, seq);
+	(void)k_pipe_write_finish(&bench_pipe, size);
+
+	if (k_pipe_read_claim(&bench_pipe, &data, size, K_NO_WAIT) != (int)size) {
+		return false;
+	}
+	ok = check_chunk(data, &data[HEADER_SIZE], payload_size, seq);
+	(void)k_pipe_read_finish(&bench_pipe, size);
+
+	return ok;
+}
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	enum xfer_mode mode = (enum xfer_mode)(uintptr_t)p1;
+	size_t size = (size_t)(uintptr_t)p2;
+
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		bool ok;
+
+		switch (mode) {
+		case XFER_COPY:
+			ok = xfer_copy(size, (uint8_t)i);
+			break;
+		case XFER_IOVEC:
+			ok = xfer_iovec(size, (uint8_t)i);
+			break;
+		default:
+			ok = xfer_zero_copy(size, (uint8_t)i);
+			break;
+		}
+
+		if (!ok) {
+			worker_failed = true;
+			return;
+		}
+	}
+}
+
+static bool test_xfer(enum xfer_mode mode, size_t size)
+{
+	const char *name = mode_names[mode];
+	timing_t start;
+	timing_t finish;
+	char tag[50];
+	char description[120];
+
+	k_pipe_init(&bench_pipe, ring, sizeof(ring));
+	worker_failed = false;
+
+	k_thread_create(&worker_thread, worker_stack, STACK_SIZE, worker,
+			(void *)(uintptr_t)mode, (void *)(uintptr_t)size, NULL,
+			K_PRIO_PREEMPT(5), WORKER_OPTIONS, K_FOREVER);
+#ifdef CONFIG_USERSPACE
+	k_mem_domain_add_thread(&bench_domain, &worker_thread);
+	k_thread_access_grant(&worker_thread, &bench_pipe);
+#endif /* CONFIG_USERSPACE */
+
+	start = timing_counter_get();
+	k_thread_start(&worker_thread);
+	k_thread_join(&worker_thread, K_FOREVER);
+	finish = timing_counter_get();
+
+	if (worker_failed) {
+		printk("FAIL: %s transfer of %zu byte chunks\n", name, size);
+		return false;
+	}
+
+	snprintf(tag, sizeof(tag), "pipe.%s.%zu_bytes", name, size);
+	snprintf(description, sizeof(description),
+		 "%s, write + read one %zu byte chunk", name, size);
+	report(tag, description, timing_cycles_get(&start, &finish),
+	       CONFIG_BENCHMARK_NUM_ITERATIONS, size);
+
+	return true;
+}
+
+int main(void)
+{
+	unsigned int freq;
+	int status = TC_PASS;
+
+#ifdef CONFIG_USERSPACE
+	struct k_mem_partition *parts[] = { &bench_partition };
+
+	if (k_mem_domain_init(&bench_domain, ARRAY_SIZE(parts), parts) != 0) {
+		printk("FAIL: k_mem_domain_init\n");
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+#endif /* CONFIG_USERSPACE */
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for pipe copy vs. iovec vs. zero-copy (%s)\n",
+	       IS_ENABLED(CONFIG_USERSPACE) ? "user mode" : "kernel mode");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	for (size_t size = 64; size <= MAX_CHUNK_SIZE; size *= 16) {
+		for (enum xfer_mode mode = XFER_COPY; mode < XFER_NUM_MODES; mode++) {
+			if (!test_xfer(mode, size)) {
+				status = TC_FAIL;
+			}
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
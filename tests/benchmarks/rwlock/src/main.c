@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure how read-side throughput of a
+ * k_rwlock scales when one reader thread per CPU reads the same table,
+ * compared against a single reader and against a k_mutex.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define MAX_WORKERS  CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+enum lock_kind {
+	LOCK_RWLOCK,
+	LOCK_MUTEX,
+};
+
+K_RWLOCK_DEFINE(bench_rwlock);
+K_MUTEX_DEFINE(bench_mutex);
+
+static volatile uint32_t table[CONFIG_BENCHMARK_TABLE_SIZE];
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_WORKERS, STACK_SIZE);
+static struct k_thread threads[MAX_WORKERS];
+static K_SEM_DEFINE(done_sem, 0, MAX_WORKERS);
+
+static uint64_t worker_cycles[MAX_WORKERS];
+static bool worker_failed[MAX_WORKERS];
+
+static void report(const char *tag, const char *str, uint64_t cycles,
+		   uint32_t count)
+{
+	uint64_t average = cycles / count;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static uint32_t read_table(void)
+{
+	uint32_t sum = 0U;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_TABLE_SIZE; i++) {
+		sum += table[i];
+	}
+
+	return sum;
+}
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	uintptr_t id = (uintptr_t)p1;
+	enum lock_kind kind = (enum lock_kind)(uintptr_t)p2;
+	uint32_t expected = read_table();
+	timing_t start;
+	timing_t finish;
+
+	ARG_UNUSED(p3);
+
+	start = timing_counter_get();
+
+	for (unsigned int iter = 0; iter < CONFIG_BENCHMARK_NUM_ITERATIONS; iter++) {
+		if (kind == LOCK_RWLOCK) {
+			if (k_rwlock_read_lock(&bench_rwlock, K_FOREVER) != 0) {
+				worker_failed[id] = true;
+				continue;
+			}
+			worker_failed[id] |= (read_table() != expected);
+			k_rwlock_read_unlock(&bench_rwlock);
+		} else {
+			k_mutex_lock(&bench_mutex, K_FOREVER);
+			worker_failed[id] |= (read_table() != expected);
+			k_mutex_unlock(&bench_mutex);
+		}
+	}
+
+	finish = timing_counter_get();
+
+	worker_cycles[id] = timing_cycles_get(&start, &finish);
+
+	k_sem_give(&done_sem);
+}
+
+static bool test_workers(enum lock_kind kind, unsigned int num_workers)
+{
+	const uint32_t ops = CONFIG_BENCHMARK_NUM_ITERATIONS;
+	const char *name = (kind == LOCK_RWLOCK) ? "rwlock" : "mutex";
+	timing_t start;
+	timing_t finish;
+	uint64_t per_worker = 0ULL;
+	bool failed = false;
+	char tag[50];
+	char description[120];
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		worker_failed[i] = false;
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, worker,
+				(void *)(uintptr_t)i, (void *)(uintptr_t)kind, NULL,
+				K_PRIO_PREEMPT(5), 0, K_FOREVER);
+	}
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_sem_take(&done_sem, K_FOREVER);
+	}
+
+	finish = timing_counter_get();
+
+	for (unsigned int i = 0; i < num_workers; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+		per_worker += worker_cycles[i];
+		failed |= worker_failed[i];
+	}
+
+	if (failed) {
+		printk("FAIL: %s read failed with %u workers\n", name,
+		       num_workers);
+		return false;
+	}
+
+	snprintf(tag, sizeof(tag), "%s.read.%u_workers", name, num_workers);
+	snprintf(description, sizeof(description),
+		 "%s, %u reader(s), lock + read + unlock per reader", name,
+		 num_workers);
+	report(tag, description, per_worker, ops * num_workers);
+
+	snprintf(tag, sizeof(tag), "%s.throughput.%u_workers", name, num_workers);
+	snprintf(description, sizeof(description),
+		 "%s, %u reader(s), wall time per lock + read + unlock", name,
+		 num_workers);
+	report(tag, description, timing_cycles_get(&start, &finish),
+	       ops * num_workers);
+
+	return true;
+}
+
+int main(void)
+{
+	unsigned int freq;
+	int status = TC_PASS;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_TABLE_SIZE; i++) {
+		table[i] = i;
+	}
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for reader/writer lock on %u CPU(s)\n",
+	       arch_num_cpus());
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	for (enum lock_kind kind = LOCK_RWLOCK; kind <= LOCK_MUTEX; kind++) {
+		if (!test_workers(kind, 1)) {
+			status = TC_FAIL;
+		}
+
+		if ((arch_num_cpus() > 1) && !test_workers(kind, arch_num_cpus())) {
+			status = TC_FAIL;
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
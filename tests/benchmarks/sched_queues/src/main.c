@@ -84,6 +84,14 @@ static void start_threads(unsigned int num_threads)
 		k_thread_create(&test_thread[i], test_stack, TEST_STACK_SIZE,
 				test_entry, (void *)(uintptr_t)i, NULL, NULL,
 				i / bucket_size, 0, K_NO_WAIT);
+
+#ifdef CONFIG_SCHED_DEADLINE
+		/* Scatter deadlines so that threads of the same priority
+		 * are not simply queued in insertion order.
+		 */
+		k_thread_deadline_set(&test_thread[i],
+				      ((i * 7919U) % CONFIG_BENCHMARK_NUM_THREADS + 1) * 1000);
+#endif /* CONFIG_SCHED_DEADLINE */
 	}
 }
 
@@ -238,9 +246,11 @@ int main(void)
 
 	freq = timing_freq_get_mhz();
 
-	printk("Time Measurements for %s sched queues\n",
+	printk("Time Measurements for %s%s%s sched queues\n",
 	       IS_ENABLED(CONFIG_SCHED_DUMB) ? "dumb" :
-	       IS_ENABLED(CONFIG_SCHED_SCALABLE) ? "scalable" : "multiq");
+	       IS_ENABLED(CONFIG_SCHED_SCALABLE) ? "scalable" : "multiq",
+	       IS_ENABLED(CONFIG_SCHED_DEADLINE) ? " EDF" : "",
+	       IS_ENABLED(CONFIG_SCHED_PER_CPU_RUNQ) ? " per-CPU" : "");
 	printk("Timing results: Clock frequency: %u MHz\n", freq);
 
 	start_threads(CONFIG_BENCHMARK_NUM_THREADS);
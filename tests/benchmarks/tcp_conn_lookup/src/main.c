@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the time to receive data on TCP
+ * connections over the loopback interface, as more and more connections
+ * are open. Every received segment has to be matched to its connection,
+ * so this shows how the connection lookup scales with their number.
+ *
+ * Data is sent on each open connection in turn and the time is taken
+ * until the peer socket has received it.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define SERVER_PORT	4242
+#define PAYLOAD_SIZE	64
+
+#define NUM_CONNECTIONS	CONFIG_BENCHMARK_NUM_CONNECTIONS
+
+BUILD_ASSERT(CONFIG_NET_MAX_CONTEXTS >= (2 * NUM_CONNECTIONS) + 1,
+	     "not enough net contexts for the connections");
+
+static int client_socks[NUM_CONNECTIONS];
+static int server_socks[NUM_CONNECTIONS];
+static uint8_t payload[PAYLOAD_SIZE];
+
+static void report(const char *tag, const char *str, uint64_t cycles,
+		   uint32_t count)
+{
+	uint64_t average = cycles / count;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static int open_connection(int listen_sock, const struct sockaddr_in *addr,
+			   int idx)
+{
+	int nodelay = 1;
+
+	client_socks[idx] = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (client_socks[idx] < 0) {
+		printk("FAIL: client socket %d: %d\n", idx, errno);
+		return -errno;
+	}
+
+	/* Each send goes out right away as a single segment */
+	(void)zsock_setsockopt(client_socks[idx], IPPROTO_TCP, TCP_NODELAY,
+			       &nodelay, sizeof(nodelay));
+
+	if (zsock_connect(client_socks[idx], (const struct sockaddr *)addr,
+			  sizeof(*addr)) < 0) {
+		printk("FAIL: connection %d: %d\n", idx, errno);
+		(void)zsock_close(client_socks[idx]);
+		return -errno;
+	}
+
+	server_socks[idx] = zsock_accept(listen_sock, NULL, NULL);
+	if (server_socks[idx] < 0) {
+		printk("FAIL: accept %d: %d\n", idx, errno);
+		(void)zsock_close(client_socks[idx]);
+		return -errno;
+	}
+
+	return 0;
+}
+
+static bool test_recv(int num_conns)
+{
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t finish;
+	char tag[50];
+	char description[120];
+	uint8_t buf[PAYLOAD_SIZE];
+
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		for (int idx = 0; idx < num_conns; idx++) {
+			size_t received = 0;
+			ssize_t ret;
+
+			start = timing_counter_get();
+
+			ret = zsock_send(client_socks[idx], payload,
+					 sizeof(payload), 0);
+			while (ret > 0 && received < sizeof(payload)) {
+				ret = zsock_recv(server_socks[idx], buf,
+						 sizeof(buf) - received, 0);
+				if (ret > 0) {
+					received += ret;
+				}
+			}
+
+			finish = timing_counter_get();
+
+			if (received < sizeof(payload)) {
+				printk("FAIL: data on connection %d: %d\n",
+				       idx, errno);
+				return false;
+			}
+			cycles += timing_cycles_get(&start, &finish);
+		}
+	}
+
+	snprintf(tag, sizeof(tag), "tcp.recv.%d_conns", num_conns);
+	snprintf(description, sizeof(description),
+		 "receive %d bytes with %d connections open", PAYLOAD_SIZE,
+		 num_conns);
+	report(tag, description, cycles,
+	       CONFIG_BENCHMARK_NUM_ITERATIONS * num_conns);
+
+	return true;
+}
+
+int main(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int num_conns = 0;
+	int listen_sock;
+	unsigned int freq;
+	int status = TC_PASS;
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for TCP receive with many connections\n");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+	printk("Connection lookup table: %lu buckets\n",
+	       BIT(CONFIG_NET_TCP_CONN_HASH_BITS));
+
+	listen_sock = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (listen_sock < 0 ||
+	    zsock_bind(listen_sock, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    zsock_listen(listen_sock, 1) < 0) {
+		printk("FAIL: cannot listen on port %d: %d\n", SERVER_PORT, errno);
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+
+	timing_start();
+
+	for (int target = 1; ; target *= 4) {
+		if (target > NUM_CONNECTIONS) {
+			target = NUM_CONNECTIONS;
+		}
+
+		while (num_conns < target) {
+			if (open_connection(listen_sock, &addr, num_conns) < 0) {
+				status = TC_FAIL;
+				goto out;
+			}
+			num_conns++;
+		}
+
+		if (!test_recv(num_conns)) {
+			status = TC_FAIL;
+			break;
+		}
+
+		if (num_conns == NUM_CONNECTIONS) {
+			break;
+		}
+	}
+
+out:
+	timing_stop();
+
+	for (int idx = 0; idx < num_conns; idx++) {
+		(void)zsock_close(server_socks[idx]);
+		(void)zsock_close(client_socks[idx]);
+	}
+	(void)zsock_close(listen_sock);
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
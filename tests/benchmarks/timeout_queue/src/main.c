@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the time required to add, abort
+ * and expire kernel timeouts while the timeout queue holds a varying
+ * number of pending timeouts. Bare _timeout records are used so that
+ * neither threads nor timers get involved in the measurements.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include <timeout_q.h>
+#include <stdio.h>
+
+/* Spread pending timeouts over several wheel levels */
+#define PENDING_SPAN  (1U << 20)
+#define PENDING_BASE  1000U
+
+/* Expiring timeouts all fall within a few wheel rotations */
+#define EXPIRY_SPAN   4096U
+
+static struct _timeout timeouts[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static uint32_t lcg_state;
+static unsigned int num_expired;
+
+static const unsigned int queue_sizes[] = {
+	10, 100, CONFIG_BENCHMARK_NUM_TIMEOUTS,
+};
+
+static uint32_t next_delay(uint32_t span)
+{
+	lcg_state = (lcg_state * 1103515245U) + 12345U;
+
+	return (lcg_state >> 8) % span;
+}
+
+static void expiry_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+
+	num_expired++;
+}
+
+static void report(const char *tag, const char *str, uint64_t cycles,
+		   uint32_t count)
+{
+	uint64_t average = cycles / count;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static void test_add_abort(unsigned int num_timeouts)
+{
+	unsigned int i;
+	unsigned int iter;
+	timing_t start;
+	timing_t finish;
+	uint64_t add_cycles = 0ULL;
+	uint64_t abort_cycles = 0ULL;
+	char tag[50];
+	char description[120];
+
+	for (iter = 0; iter < CONFIG_BENCHMARK_NUM_ITERATIONS; iter++) {
+		lcg_state = iter;
+
+		for (i = 0; i < num_timeouts; i++) {
+			k_timeout_t delay = K_TICKS(PENDING_BASE + next_delay(PENDING_SPAN));
+
+			start = timing_counter_get();
+			z_add_timeout(&timeouts[i], expiry_fn, delay);
+			finish = timing_counter_get();
+			add_cycles += timing_cycles_get(&start, &finish);
+		}
+
+		for (i = 0; i < num_timeouts; i++) {
+			start = timing_counter_get();
+			z_abort_timeout(&timeouts[i]);
+			finish = timing_counter_get();
+			abort_cycles += timing_cycles_get(&start, &finish);
+		}
+	}
+
+	snprintf(tag, sizeof(tag), "timeout.add.%05u.pending", num_timeouts);
+	snprintf(description, sizeof(description),
+		 "Add timeout to a queue of up to %u timeouts", num_timeouts);
+	report(tag, description, add_cycles,
+	       num_timeouts * CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	snprintf(tag, sizeof(tag), "timeout.abort.%05u.pending", num_timeouts);
+	snprintf(description, sizeof(description),
+		 "Abort timeout from a queue of up to %u timeouts", num_timeouts);
+	report(tag, description, abort_cycles,
+	       num_timeouts * CONFIG_BENCHMARK_NUM_ITERATIONS);
+}
+
+static bool test_expire(unsigned int num_timeouts)
+{
+	unsigned int i;
+	unsigned int iter;
+	unsigned int key;
+	timing_t start;
+	timing_t finish;
+	uint64_t expire_cycles = 0ULL;
+	char tag[50];
+	char description[120];
+
+	for (iter = 0; iter < CONFIG_BENCHMARK_NUM_ITERATIONS; iter++) {
+		lcg_state = iter;
+		num_expired = 0;
+
+		for (i = 0; i < num_timeouts; i++) {
+			z_add_timeout(&timeouts[i], expiry_fn,
+				      K_TICKS(next_delay(EXPIRY_SPAN)));
+		}
+
+		/*
+		 * Announce the ticks by hand rather than waiting for the
+		 * system timer. Interrupts stay locked so that a real tick
+		 * cannot sneak into the measurement. Announcing twice the
+		 * span covers any ticks that elapsed since the last real
+		 * announcement.
+		 */
+		key = irq_lock();
+		start = timing_counter_get();
+		sys_clock_announce(2 * EXPIRY_SPAN);
+		finish = timing_counter_get();
+		irq_unlock(key);
+
+		expire_cycles += timing_cycles_get(&start, &finish);
+
+		if (num_expired != num_timeouts) {
+			printk("Expired %u of %u timeouts\n", num_expired,
+			       num_timeouts);
+			return false;
+		}
+	}
+
+	snprintf(tag, sizeof(tag), "timeout.expire.%05u.pending", num_timeouts);
+	snprintf(description, sizeof(description),
+		 "Expire timeout from a queue of up to %u timeouts", num_timeouts);
+	report(tag, description, expire_cycles,
+	       num_timeouts * CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	return true;
+}
+
+int main(void)
+{
+	unsigned int i;
+	unsigned int freq;
+	int status = TC_PASS;
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_WHEEL) ? "wheel" : "list");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	for (i = 0; i < ARRAY_SIZE(timeouts); i++) {
+		z_init_timeout(&timeouts[i]);
+	}
+
+	timing_start();
+
+	for (i = 0; i < ARRAY_SIZE(queue_sizes); i++) {
+		test_add_abort(queue_sizes[i]);
+	}
+
+	/* Expiry tests advance the tick count, so they run last */
+	for (i = 0; i < ARRAY_SIZE(queue_sizes); i++) {
+		if (!test_expire(queue_sizes[i])) {
+			status = TC_FAIL;
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -15,6 +15,9 @@
  * reduce the memory footprint as not only are thread stacks not required,
  * but we also do not need the full k_thread structure for each of these
  * dummy threads.
+ *
+ * It also measures the time needed to wake a number of real threads pended
+ * on a kernel object at once.
  */
 
 #include <zephyr/kernel.h>
@@ -211,10 +214,164 @@ static void compute_and_report_stats(unsigned int num_threads, unsigned int num_
 #endif
 }
 
+#define WAKE_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+enum wake_op {
+	WAKE_SEM_GIVE,
+	WAKE_SEM_RESET,
+	WAKE_CONDVAR_BROADCAST,
+	WAKE_EVENT_POST,
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(wake_stacks, CONFIG_BENCHMARK_NUM_WAKE_THREADS,
+				   WAKE_STACK_SIZE);
+static struct k_thread wake_threads[CONFIG_BENCHMARK_NUM_WAKE_THREADS];
+
+static K_SEM_DEFINE(wake_sem, 0, K_SEM_MAX_LIMIT);
+static K_MUTEX_DEFINE(wake_mutex);
+static K_CONDVAR_DEFINE(wake_condvar);
+static K_EVENT_DEFINE(wake_event);
+
+static volatile enum wake_op wake_op;
+static atomic_t wake_count;
+
+uint64_t wake_cycles[CONFIG_BENCHMARK_NUM_ITERATIONS];
+
+/**
+ * Each wake thread has a higher priority than the main thread, so that on
+ * a single CPU it immediately pends again on the object selected by
+ * wake_op once it has been woken and the scheduler is unlocked.
+ */
+static void wake_thread_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		switch (wake_op) {
+		case WAKE_SEM_GIVE:
+		case WAKE_SEM_RESET:
+			(void)k_sem_take(&wake_sem, K_FOREVER);
+			break;
+		case WAKE_CONDVAR_BROADCAST:
+			k_mutex_lock(&wake_mutex, K_FOREVER);
+			(void)k_condvar_wait(&wake_condvar, &wake_mutex, K_FOREVER);
+			k_mutex_unlock(&wake_mutex);
+			break;
+		case WAKE_EVENT_POST:
+			(void)k_event_wait(&wake_event, BIT(0), true, K_FOREVER);
+			break;
+		}
+
+		atomic_inc(&wake_count);
+	}
+}
+
+static void wake_all(enum wake_op op)
+{
+	unsigned int i;
+
+	switch (op) {
+	case WAKE_SEM_GIVE:
+		for (i = 0; i < CONFIG_BENCHMARK_NUM_WAKE_THREADS; i++) {
+			k_sem_give(&wake_sem);
+		}
+		break;
+	case WAKE_SEM_RESET:
+		k_sem_reset(&wake_sem);
+		break;
+	case WAKE_CONDVAR_BROADCAST:
+		(void)k_condvar_broadcast(&wake_condvar);
+		break;
+	case WAKE_EVENT_POST:
+		(void)k_event_post(&wake_event, BIT(0));
+		break;
+	}
+}
+
+/**
+ * Measure the time needed to ready all the wake threads with @a op. The
+ * scheduler is locked during the measurement so that it excludes switching
+ * to the woken threads.
+ */
+static bool test_wake_all(enum wake_op op, const char *tag, const char *str)
+{
+	unsigned int i;
+	timing_t start;
+	timing_t finish;
+	atomic_val_t expected;
+
+	/* Move all the wake threads over to the object under test */
+
+	k_sched_lock();
+	wake_all(wake_op);
+	wake_op = op;
+	k_sched_unlock();
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		expected = atomic_get(&wake_count) + CONFIG_BENCHMARK_NUM_WAKE_THREADS;
+
+		k_sched_lock();
+		start = timing_counter_get();
+		wake_all(op);
+		finish = timing_counter_get();
+		k_sched_unlock();
+
+		wake_cycles[i] = timing_cycles_get(&start, &finish);
+
+		if (atomic_get(&wake_count) != expected) {
+			printk("FAIL: %s did not wake all %u threads\n", str,
+			       CONFIG_BENCHMARK_NUM_WAKE_THREADS);
+			return false;
+		}
+	}
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_ITERATIONS, 1, wake_cycles, tag, str);
+
+	return true;
+}
+
+static bool test_wake(void)
+{
+	bool ok = true;
+	unsigned int i;
+	int priority = k_thread_priority_get(k_current_get());
+
+	/* The wake threads must preempt the main thread */
+
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(10));
+
+	wake_op = WAKE_SEM_GIVE;
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_WAKE_THREADS; i++) {
+		k_thread_create(&wake_threads[i], wake_stacks[i], WAKE_STACK_SIZE,
+				wake_thread_entry, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(5), 0, K_NO_WAIT);
+	}
+
+	ok &= test_wake_all(WAKE_SEM_GIVE, "sched.wake.threads.sem_give",
+			    "Wake threads one at a time with k_sem_give()");
+	ok &= test_wake_all(WAKE_SEM_RESET, "sched.wake.threads.sem_reset",
+			    "Wake all threads with k_sem_reset()");
+	ok &= test_wake_all(WAKE_CONDVAR_BROADCAST, "sched.wake.threads.condvar_broadcast",
+			    "Wake all threads with k_condvar_broadcast()");
+	ok &= test_wake_all(WAKE_EVENT_POST, "sched.wake.threads.event_post",
+			    "Wake all threads with k_event_post()");
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_WAKE_THREADS; i++) {
+		k_thread_abort(&wake_threads[i]);
+	}
+
+	k_thread_priority_set(k_current_get(), priority);
+
+	return ok;
+}
+
 int main(void)
 {
 	unsigned int i;
 	unsigned int freq;
+	int status;
 #ifdef CONFIG_BENCHMARK_VERBOSE
 	char description[120];
 	char tag[50];
@@ -318,9 +475,11 @@ int main(void)
 	}
 #endif
 
+	status = test_wake() ? TC_PASS : TC_FAIL;
+
 	timing_stop();
 
-	TC_END_REPORT(0);
+	TC_END_REPORT(status);
 
 	return 0;
 }
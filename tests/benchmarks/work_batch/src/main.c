@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains tests that measure the time to reschedule and cancel
+ * a large set of delayable work items one at a time, compared against
+ * k_work_reschedule_batch() and k_work_cancel_delayable_batch().
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <stdio.h>
+
+#define NUM_ITEMS CONFIG_BENCHMARK_NUM_ITEMS
+
+/* Far enough out that no item ever expires during the benchmark */
+#define BASE_DELAY_TICKS 100000
+
+static struct k_work_delayable items[NUM_ITEMS];
+static struct k_work_delayable *item_ptrs[NUM_ITEMS];
+static k_timeout_t delays[NUM_ITEMS];
+
+static void report(const char *tag, const char *str, uint64_t cycles,
+		   uint32_t count)
+{
+	uint64_t average = cycles / count;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %-40s - %-50s : %7llu cycles , %7u ns :\n", tag, str,
+	       average, (uint32_t)timing_cycles_to_ns(average));
+#else
+	ARG_UNUSED(tag);
+
+	printk("%-60s : %7llu cycles (%7u nsec)\n", str, average,
+	       (uint32_t)timing_cycles_to_ns(average));
+#endif
+}
+
+static void item_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+}
+
+/* Pick new deadlines for all items, either all equal or scattered */
+static void make_delays(bool scattered, uint32_t round)
+{
+	uint32_t seed = round * 2654435761U;
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		uint32_t offset = 0U;
+
+		if (scattered) {
+			seed = seed * 1103515245U + 12345U;
+			offset = (seed >> 16) % (4U * NUM_ITEMS);
+		}
+
+		delays[i] = K_TICKS(BASE_DELAY_TICKS + round + offset);
+	}
+}
+
+static uint64_t reschedule_single(void)
+{
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		(void)k_work_reschedule_for_queue(&k_sys_work_q, &items[i], delays[i]);
+	}
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static uint64_t reschedule_batch(void)
+{
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+
+	(void)k_work_reschedule_batch(&k_sys_work_q, item_ptrs, delays, NUM_ITEMS);
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static uint64_t cancel_single(void)
+{
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		(void)k_work_cancel_delayable(&items[i]);
+	}
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static uint64_t cancel_batch(void)
+{
+	timing_t start;
+	timing_t finish;
+
+	start = timing_counter_get();
+
+	(void)k_work_cancel_delayable_batch(item_ptrs, NUM_ITEMS);
+
+	finish = timing_counter_get();
+
+	return timing_cycles_get(&start, &finish);
+}
+
+static bool all_idle(void)
+{
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		if (k_work_delayable_busy_get(&items[i]) != 0) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool test_reschedule(bool batch, bool scattered)
+{
+	const uint32_t ops = CONFIG_BENCHMARK_NUM_ITERATIONS * NUM_ITEMS;
+	const char *mode = batch ? "batch" : "single";
+	const char *pattern = scattered ? "scattered" : "equal";
+	uint64_t resched_cycles = 0ULL;
+	uint64_t cancel_cycles = 0ULL;
+	char tag[50];
+	char description[120];
+
+	for (uint32_t round = 0; round < CONFIG_BENCHMARK_NUM_ITERATIONS; round++) {
+		/* Start from scheduled items, so rescheduling moves deadlines */
+		make_delays(scattered, round);
+		(void)k_work_reschedule_batch(&k_sys_work_q, item_ptrs, delays, NUM_ITEMS);
+
+		make_delays(scattered, round + 1U);
+		resched_cycles += batch ? reschedule_batch() : reschedule_single();
+		cancel_cycles += batch ? cancel_batch() : cancel_single();
+
+		if (!all_idle()) {
+			printk("FAIL: %s cancel left busy items\n", mode);
+			return false;
+		}
+	}
+
+	snprintf(tag, sizeof(tag), "work.reschedule.%s.%s", mode, pattern);
+	snprintf(description, sizeof(description),
+		 "reschedule %u items, %s deadlines, %s, per item", NUM_ITEMS,
+		 pattern, mode);
+	report(tag, description, resched_cycles, ops);
+
+	snprintf(tag, sizeof(tag), "work.cancel.%s.%s", mode, pattern);
+	snprintf(description, sizeof(description),
+		 "cancel %u items, %s deadlines, %s, per item", NUM_ITEMS,
+		 pattern, mode);
+	report(tag, description, cancel_cycles, ops);
+
+	return true;
+}
+
+int main(void)
+{
+	unsigned int freq;
+	int status = TC_PASS;
+
+	for (unsigned int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init_delayable(&items[i], item_handler);
+		item_ptrs[i] = &items[i];
+	}
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for delayable work batches of %u items\n",
+	       NUM_ITEMS);
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	for (int scattered = 0; scattered <= 1; scattered++) {
+		if (!test_reschedule(false, scattered) ||
+		    !test_reschedule(true, scattered)) {
+			status = TC_FAIL;
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -343,6 +343,66 @@ ZTEST(ipi, test_high_thread_wakes_some_ipis)
 	zassert_true(set[id] == 0, "Current CPU got %u IPI(s).\n", set[id]);
 }
 
+/**
+ * Verify that the IPI statistics account for each IPI sent while waking a
+ * thread whose priority is higher than all currently executing threads,
+ * and that at least one of them led to a context switch.
+ */
+ZTEST(ipi, test_ipi_stats)
+{
+#ifdef CONFIG_SCHED_IPI_STATS
+	struct k_ipi_stats before[CONFIG_MP_MAX_NUM_CPUS];
+	struct k_ipi_stats after;
+	uint32_t  sent = 0;
+	uint32_t  handled = 0;
+	uint32_t  useful = 0;
+	uint32_t  id;
+	int priority;
+	unsigned int i;
+
+	priority = k_thread_priority_get(k_current_get());
+	atomic_clear(&busy_started);
+
+	alt_thread_create(priority - 1 - NUM_THREADS, "High");
+
+	id = busy_threads_create(priority - 1);
+
+	busy_threads_priority_set(0, 1);
+	k_busy_wait(DELAY_FOR_IPIS);
+
+	for (i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		zassert_ok(k_ipi_stats_get(i, &before[i]));
+	}
+
+	k_sem_give(&sem);
+	k_busy_wait(DELAY_FOR_IPIS);
+
+	for (i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		zassert_ok(k_ipi_stats_get(i, &after));
+
+		sent += after.sent - before[i].sent;
+		handled += (after.useful - before[i].useful) +
+			   (after.spurious - before[i].spurious);
+		useful += after.useful - before[i].useful;
+
+		if (i == id) {
+			zassert_equal(after.sent, before[i].sent,
+				      "Current CPU was sent an IPI");
+		}
+	}
+
+	alt_thread_done = true;
+
+	zassert_equal(sent, NUM_THREADS, "%u IPIs sent", sent);
+	zassert_equal(handled, NUM_THREADS, "%u IPIs handled", handled);
+	zassert_true(useful >= 1, "No IPI led to a context switch");
+
+	zassert_equal(k_ipi_stats_get(CONFIG_MP_MAX_NUM_CPUS, &after), -EINVAL);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SCHED_IPI_STATS */
+}
+
 /**
  * Verify that lowering the priority of an active thread results in an IPI.
  * If directed IPIs are enabled, then only the CPU executing that active
@@ -105,6 +105,9 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 #ifndef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	printk("    - in ISR: %lu\n", stats->pagefaults.in_isr);
 #endif
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	printk("    - Pages read ahead: %lu\n", stats->pagefaults.read_ahead);
+#endif
 
 	printk("* Eviction (%s):\n", scope);
 	printk("    - Total pages evicted: %lu\n",
@@ -113,6 +116,10 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+	printk("    - Page frames scanned: %lu\n",
+	       stats->eviction.scanned);
+	printk("    - Selection cycles: %llu (max %u)\n",
+	       stats->eviction.select_cycles, stats->eviction.select_cycles_max);
 }
 
 static void touch_anon_pages(bool zig, bool zag)
@@ -163,10 +170,16 @@ static void touch_anon_pages(bool zig, bool zag)
 	print_paging_stats(&stats, "kernel");
 	zassert_not_equal(stats.eviction.dirty, 0UL,
 			  "there should be dirty pages being evicted.");
+	zassert_true(stats.eviction.scanned >=
+		     stats.eviction.clean + stats.eviction.dirty,
+		     "page frames scanned not accounted for.");
 
 #ifdef CONFIG_EVICTION_NRU
 	k_msleep(CONFIG_EVICTION_NRU_PERIOD * 2);
 #endif /* CONFIG_EVICTION_NRU */
+#ifdef CONFIG_EVICTION_CLOCK_AGING
+	k_msleep(CONFIG_EVICTION_CLOCK_AGING_PERIOD * 2);
+#endif /* CONFIG_EVICTION_CLOCK_AGING */
 
 	/* There should be some clean pages to be evicted now,
 	 * since the arena is not modified.
@@ -236,6 +249,13 @@ static void test_k_mem_page_out(void)
 {
 	unsigned long faults;
 	int key, ret;
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	struct k_mem_paging_stats_t stats;
+	unsigned long read_ahead;
+
+	k_mem_paging_stats_get(&stats);
+	read_ahead = stats.pagefaults.read_ahead;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 
 	/* Lock IRQs to prevent other pagefaults from happening while we
 	 * are measuring stuff
@@ -252,9 +272,20 @@ static void test_k_mem_page_out(void)
 	faults = k_mem_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	/* Sequential page faults read the following pages ahead */
+	zassert_true(faults > 0 && faults < HALF_PAGES,
+		     "unexpected num pagefaults expected less than %lu got %d",
+		     HALF_PAGES, faults);
+
+	k_mem_paging_stats_get(&stats);
+	zassert_true(stats.pagefaults.read_ahead > read_ahead,
+		     "no pages read ahead");
+#else
 	zassert_equal(faults, HALF_PAGES,
 		      "unexpected num pagefaults expected %lu got %d",
 		      HALF_PAGES, faults);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
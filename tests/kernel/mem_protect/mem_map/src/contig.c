@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <mmu.h>
+
+#ifdef CONFIG_MMU_CONTIG_ALLOC
+
+#define CONTIG_PAGES	8
+#define CONTIG_SIZE	(CONTIG_PAGES * CONFIG_MMU_PAGE_SIZE)
+
+/**
+ * Show that K_MEM_MAP_CONTIG maps physically contiguous, pinned page frames
+ * and that they are all given back on unmap
+ *
+ * @ingroup kernel_memprotect_tests
+ * @see k_mem_map(), k_mem_unmap()
+ */
+ZTEST(mem_map_api, test_k_mem_map_contig)
+{
+	size_t free_mem = k_mem_free_get();
+	uintptr_t base_phys;
+	uintptr_t phys;
+	uint8_t *mapped;
+
+	mapped = k_mem_map(CONTIG_SIZE, K_MEM_PERM_RW | K_MEM_MAP_CONTIG);
+	zassert_not_null(mapped, "failed to map contiguous memory");
+	zassert_equal(k_mem_free_get(), free_mem - CONTIG_SIZE,
+		      "incorrect free memory accounting");
+
+	zassert_ok(arch_page_phys_get(mapped, &base_phys));
+	for (size_t i = 0; i < CONTIG_PAGES; i++) {
+		uint8_t *pos = mapped + (i * CONFIG_MMU_PAGE_SIZE);
+
+		zassert_ok(arch_page_phys_get(pos, &phys));
+		zassert_equal(phys, base_phys + (i * CONFIG_MMU_PAGE_SIZE),
+			      "page %zu not physically contiguous", i);
+		zassert_true(k_mem_page_frame_is_pinned(k_mem_phys_to_page_frame(phys)),
+			     "page %zu not pinned", i);
+		zassert_equal(pos[0], 0, "page %zu not zeroed", i);
+	}
+
+	/* Guard pages are still in place */
+	zassert_not_equal(arch_page_phys_get(mapped - CONFIG_MMU_PAGE_SIZE, NULL), 0);
+	zassert_not_equal(arch_page_phys_get(mapped + CONTIG_SIZE, NULL), 0);
+
+	memset(mapped, 0xa5, CONTIG_SIZE);
+	k_mem_unmap(mapped, CONTIG_SIZE);
+	zassert_equal(k_mem_free_get(), free_mem,
+		      "k_mem_unmap has not freed physical memory");
+	zassert_not_equal(arch_page_phys_get(mapped, NULL), 0);
+
+	/* Not for unpaged mappings */
+	zassert_is_null(k_mem_map_phys_guard(0, CONTIG_SIZE,
+					     K_MEM_PERM_RW | K_MEM_MAP_CONTIG |
+					     K_MEM_MAP_UNPAGED, false));
+}
+
+#define LARGE_SIZE	MB(2)
+
+/**
+ * Show that a K_MEM_MAP_CONTIG region is aligned for, and works with, the
+ * large pages of the architecture, and that their virtual region can be
+ * mapped with pages again once unmapped
+ *
+ * @ingroup kernel_memprotect_tests
+ * @see k_mem_map(), k_mem_unmap()
+ */
+ZTEST(mem_map_api, test_k_mem_map_contig_large)
+{
+	size_t align = arch_virt_region_align(0, LARGE_SIZE);
+	size_t free_mem = k_mem_free_get();
+	uintptr_t base_phys;
+	uintptr_t phys;
+	uint8_t *mapped;
+
+	if (align == CONFIG_MMU_PAGE_SIZE) {
+		ztest_test_skip();
+	}
+
+	mapped = k_mem_map(LARGE_SIZE, K_MEM_PERM_RW | K_MEM_MAP_CONTIG);
+	zassert_not_null(mapped, "failed to map contiguous memory");
+
+	zassert_ok(arch_page_phys_get(mapped, &base_phys));
+	zassert_equal(POINTER_TO_UINT(mapped) % align, 0,
+		      "region not aligned for large pages");
+	zassert_equal(base_phys % align, 0,
+		      "page frames not aligned for large pages");
+
+	/* Every page within the large pages is translated */
+	for (size_t offset = 0; offset < LARGE_SIZE;
+	     offset += CONFIG_MMU_PAGE_SIZE) {
+		zassert_ok(arch_page_phys_get(mapped + offset, &phys));
+		zassert_equal(phys, base_phys + offset,
+			      "page at offset %zu not physically contiguous",
+			      offset);
+	}
+
+	memset(mapped, 0xa5, LARGE_SIZE);
+	zassert_equal(mapped[LARGE_SIZE - 1], 0xa5, "bad contents");
+
+	/* Guard pages are still in place */
+	zassert_not_equal(arch_page_phys_get(mapped - CONFIG_MMU_PAGE_SIZE, NULL), 0);
+	zassert_not_equal(arch_page_phys_get(mapped + LARGE_SIZE, NULL), 0);
+
+	k_mem_unmap(mapped, LARGE_SIZE);
+	zassert_equal(k_mem_free_get(), free_mem,
+		      "k_mem_unmap has not freed physical memory");
+	for (size_t offset = 0; offset < LARGE_SIZE;
+	     offset += CONFIG_MMU_PAGE_SIZE) {
+		zassert_not_equal(arch_page_phys_get(mapped + offset, NULL), 0,
+				  "page at offset %zu still mapped", offset);
+	}
+
+	/* The same virtual region mapped with pages again */
+	mapped = k_mem_map(LARGE_SIZE, K_MEM_PERM_RW);
+	zassert_not_null(mapped, "failed to map memory");
+	memset(mapped, 0x5a, LARGE_SIZE);
+	zassert_equal(mapped[LARGE_SIZE - 1], 0x5a, "bad contents");
+	k_mem_unmap(mapped, LARGE_SIZE);
+	zassert_equal(k_mem_free_get(), free_mem,
+		      "k_mem_unmap has not freed physical memory");
+}
+
+#endif /* CONFIG_MMU_CONTIG_ALLOC */
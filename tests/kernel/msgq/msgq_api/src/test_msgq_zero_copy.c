@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#ifdef CONFIG_MSGQ_ZERO_COPY
+
+#define ZC_MSGQ_LEN 3
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+K_THREAD_STACK_DECLARE(tstack1, STACK_SIZE);
+K_THREAD_STACK_DECLARE(tstack2, STACK_SIZE);
+extern struct k_thread tdata;
+extern struct k_thread tdata1;
+extern struct k_thread tdata2;
+extern k_tid_t tids[2];
+extern struct k_msgq msgq;
+
+/* Accessible from user mode, so user threads may reserve and claim slots */
+static ZTEST_BMEM char __aligned(4) zc_buffer[MSG_SIZE * ZC_MSGQ_LEN];
+
+static void zc_put(uint32_t value)
+{
+	zassert_ok(k_msgq_put(&msgq, &value, K_NO_WAIT));
+}
+
+static uint32_t zc_get(void)
+{
+	uint32_t value = 0U;
+
+	zassert_ok(k_msgq_get(&msgq, &value, K_NO_WAIT));
+
+	return value;
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test sending messages in place
+ * @see k_msgq_reserve(), k_msgq_commit()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_reserve_commit)
+{
+	uint32_t *slot;
+	void *other;
+
+	k_msgq_init(&msgq, zc_buffer, MSG_SIZE, ZC_MSGQ_LEN);
+
+	zassert_ok(k_msgq_reserve(&msgq, (void **)&slot, K_NO_WAIT));
+	zassert_equal(k_msgq_reserve(&msgq, &other, K_NO_WAIT), -EBUSY);
+	*slot = MSG0;
+
+	/* Put behind the reserved slot, held back until it is committed */
+	zc_put(MSG1);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+	zassert_equal(k_msgq_num_free_get(&msgq), 1);
+	zassert_equal(k_msgq_get(&msgq, &other, K_NO_WAIT), -ENOMSG);
+
+	zassert_equal(k_msgq_commit(&msgq, NULL), -EINVAL);
+	zassert_ok(k_msgq_commit(&msgq, slot));
+	zassert_equal(k_msgq_commit(&msgq, slot), -EINVAL);
+	zassert_equal(k_msgq_num_used_get(&msgq), 2);
+
+	zassert_equal(zc_get(), MSG0);
+	zassert_equal(zc_get(), MSG1);
+	zassert_equal(k_msgq_num_free_get(&msgq), ZC_MSGQ_LEN);
+}
+
+/**
+ * @brief Test receiving messages in place
+ * @see k_msgq_claim(), k_msgq_release()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim_release)
+{
+	uint32_t *slot;
+	void *other;
+
+	k_msgq_init(&msgq, zc_buffer, MSG_SIZE, ZC_MSGQ_LEN);
+
+	zassert_equal(k_msgq_claim(&msgq, (void **)&slot, K_NO_WAIT), -ENOMSG);
+
+	zc_put(MSG0);
+	zc_put(MSG1);
+	zassert_ok(k_msgq_claim(&msgq, (void **)&slot, K_NO_WAIT));
+	zassert_equal(*slot, MSG0);
+	zassert_equal(k_msgq_claim(&msgq, &other, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_msgq_num_used_get(&msgq), 1);
+
+	/* The slot read behind the claimed one is not reused before release */
+	zassert_equal(zc_get(), MSG1);
+	zc_put(MSG0);
+	zassert_equal(k_msgq_num_free_get(&msgq), 0);
+	zassert_equal(k_msgq_put(&msgq, &other, K_NO_WAIT), -ENOMSG);
+
+	zassert_equal(k_msgq_release(&msgq, NULL), -EINVAL);
+	zassert_ok(k_msgq_release(&msgq, slot));
+	zassert_equal(k_msgq_num_free_get(&msgq), ZC_MSGQ_LEN - 1);
+	zassert_equal(zc_get(), MSG0);
+}
+
+/**
+ * @brief Test purging a message queue with slots handed out
+ * @see k_msgq_purge()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_purge)
+{
+	uint32_t *claimed;
+	uint32_t *reserved;
+
+	k_msgq_init(&msgq, zc_buffer, MSG_SIZE, ZC_MSGQ_LEN);
+
+	zc_put(MSG0);
+	zassert_ok(k_msgq_claim(&msgq, (void **)&claimed, K_NO_WAIT));
+	zc_put(MSG1);
+	zassert_ok(k_msgq_reserve(&msgq, (void **)&reserved, K_NO_WAIT));
+	*reserved = MSG0;
+
+	k_msgq_purge(&msgq);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+	zassert_equal(k_msgq_num_free_get(&msgq), 0);
+
+	/* Both slots stay valid, the reserved message is still sent */
+	zassert_ok(k_msgq_commit(&msgq, reserved));
+	zassert_ok(k_msgq_release(&msgq, claimed));
+	zassert_equal(k_msgq_num_free_get(&msgq), ZC_MSGQ_LEN - 1);
+	zassert_equal(zc_get(), MSG0);
+
+	zc_put(MSG0);
+	zc_put(MSG1);
+	zassert_equal(zc_get(), MSG0);
+	zassert_equal(zc_get(), MSG1);
+}
+
+static void zc_sender(void *p1, void *p2, void *p3)
+{
+	uint32_t *slot;
+
+	for (uint32_t i = 0; i < 2 * ZC_MSGQ_LEN; i++) {
+		zassert_ok(k_msgq_reserve(&msgq, (void **)&slot, TIMEOUT));
+		*slot = MSG0 + i;
+		zassert_ok(k_msgq_commit(&msgq, slot));
+	}
+}
+
+static void zc_receive(void)
+{
+	uint32_t *slot;
+
+	for (uint32_t i = 0; i < 2 * ZC_MSGQ_LEN; i++) {
+		zassert_ok(k_msgq_claim(&msgq, (void **)&slot, TIMEOUT));
+		zassert_equal(*slot, MSG0 + i);
+		zassert_ok(k_msgq_release(&msgq, slot));
+	}
+}
+
+/**
+ * @brief Test blocking on zero-copy calls, from a user mode sender
+ * @see k_msgq_reserve(), k_msgq_claim()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_zero_copy_block)
+{
+	k_msgq_init(&msgq, zc_buffer, MSG_SIZE, ZC_MSGQ_LEN);
+
+	/* The receiver waits for messages, then the sender for slots */
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE, zc_sender,
+				  NULL, NULL, NULL, K_PRIO_PREEMPT(0),
+				  K_USER | K_INHERIT_PERMS, K_MSEC(10));
+
+	zc_receive();
+
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+}
+
+static ZTEST_BMEM uint32_t zc_got;
+
+static void zc_blocked_get(void *p1, void *p2, void *p3)
+{
+	zassert_ok(k_msgq_get(&msgq, &zc_got, TIMEOUT));
+}
+
+static void zc_blocked_put(void *p1, void *p2, void *p3)
+{
+	uint32_t value = MSG1;
+
+	zassert_ok(k_msgq_put(&msgq, &value, TIMEOUT));
+}
+
+static void zc_start_waiters(bool getter_first)
+{
+	k_thread_entry_t first = getter_first ? zc_blocked_get : zc_blocked_put;
+	k_thread_entry_t second = getter_first ? zc_blocked_put : zc_blocked_get;
+
+	/* Both pend before this returns, the first one ahead of the second */
+	tids[0] = k_thread_create(&tdata1, tstack1, STACK_SIZE, first,
+				  NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0,
+				  K_NO_WAIT);
+	tids[1] = k_thread_create(&tdata2, tstack2, STACK_SIZE, second,
+				  NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0,
+				  K_NO_WAIT);
+
+	k_msleep(TIMEOUT_MS >> 1);
+}
+
+static void zc_join_waiters(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(tids); i++) {
+		k_thread_join(tids[i], K_FOREVER);
+		tids[i] = NULL;
+	}
+}
+
+/**
+ * @brief Test committing with a getter and a putter both blocked
+ *
+ * With a single slot reserved, a getter waits for a message and a putter
+ * for space at the same time.  The committed message must go to the
+ * getter, and the slot it frees to the putter.
+ *
+ * @see k_msgq_reserve(), k_msgq_commit()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_reserve_blocked_get_put)
+{
+	uint32_t *slot;
+
+	for (int i = 0; i < 2; i++) {
+		k_msgq_init(&msgq, zc_buffer, MSG_SIZE, 1);
+		zc_got = 0U;
+
+		zassert_ok(k_msgq_reserve(&msgq, (void **)&slot, K_NO_WAIT));
+		zc_start_waiters(i == 0);
+
+		*slot = MSG0;
+		zassert_ok(k_msgq_commit(&msgq, slot));
+		zc_join_waiters();
+
+		zassert_equal(zc_got, MSG0);
+		zassert_equal(zc_get(), MSG1);
+		zassert_equal(k_msgq_num_free_get(&msgq), 1);
+	}
+}
+
+/**
+ * @brief Test releasing with a getter and a putter both blocked
+ *
+ * With the single slot claimed, a getter waits for a message and a putter
+ * for space at the same time.  The released slot must take the putter's
+ * message, which is then handed to the getter.
+ *
+ * @see k_msgq_claim(), k_msgq_release()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_claim_blocked_get_put)
+{
+	uint32_t *slot;
+
+	for (int i = 0; i < 2; i++) {
+		k_msgq_init(&msgq, zc_buffer, MSG_SIZE, 1);
+		zc_got = 0U;
+
+		zc_put(MSG0);
+		zassert_ok(k_msgq_claim(&msgq, (void **)&slot, K_NO_WAIT));
+		zc_start_waiters(i == 0);
+
+		zassert_equal(*slot, MSG0);
+		zassert_ok(k_msgq_release(&msgq, slot));
+		zc_join_waiters();
+
+		zassert_equal(zc_got, MSG1);
+		zassert_equal(k_msgq_num_used_get(&msgq), 0);
+		zassert_equal(k_msgq_num_free_get(&msgq), 1);
+	}
+}
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_MSGQ_ZERO_COPY */
@@ -67,6 +67,11 @@ static SYS_MUTEX_DEFINE(no_access_mutex);
 #endif
 static ZTEST_BMEM SYS_MUTEX_DEFINE(not_my_mutex);
 static ZTEST_BMEM SYS_MUTEX_DEFINE(bad_count_mutex);
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+static ZTEST_BMEM SYS_MUTEX_DEFINE(forged_owner_mutex);
+/* Never granted to the test thread */
+static struct k_thread forged_owner_thread;
+#endif
 
 #ifdef CONFIG_USERSPACE
 #define ZTEST_USER_OR_NOT ZTEST_USER
@@ -447,8 +452,10 @@ ZTEST(mutex_complex, test_supervisor_access)
 {
 	int rv;
 
-#ifdef CONFIG_USERSPACE
-	/* coverage for get_k_mutex checks */
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FUTEX)
+	/* coverage for get_k_mutex checks, the futex fast path would
+	 * dereference these
+	 */
 	rv = sys_mutex_lock((struct sys_mutex *)NULL, K_NO_WAIT);
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_lock((struct sys_mutex *)k_current_get(), K_NO_WAIT);
@@ -467,7 +474,7 @@ ZTEST(mutex_complex, test_supervisor_access)
 
 ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 {
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FUTEX)
 	int rv;
 
 	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
@@ -476,7 +483,64 @@ ZTEST_USER_OR_NOT(mutex_complex, test_user_access)
 	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
 #else
 	ztest_test_skip();
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FUTEX */
+}
+
+ZTEST_USER_OR_NOT(mutex_complex, test_futex_fast_path)
+{
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	int rv;
+
+	/* Uncontended locking only touches the mutex word */
+	rv = sys_mutex_lock(&private_mutex, K_NO_WAIT);
+	zassert_equal(rv, 0, "Failed to lock private mutex");
+	zassert_equal(atomic_get(&private_mutex.val), self);
+
+	rv = sys_mutex_lock(&private_mutex, K_NO_WAIT);
+	zassert_equal(rv, 0, "Failed to recursively lock private mutex");
+	zassert_equal(private_mutex.lock_count, 2U);
+
+	rv = sys_mutex_unlock(&private_mutex);
+	zassert_equal(rv, 0, "Failed to unlock private mutex");
+	zassert_equal(atomic_get(&private_mutex.val), self);
+
+	rv = sys_mutex_unlock(&private_mutex);
+	zassert_equal(rv, 0, "Failed to unlock private mutex");
+	zassert_equal(atomic_get(&private_mutex.val), 0);
+
+	rv = sys_mutex_unlock(&private_mutex);
+	zassert_equal(rv, -EINVAL, "Unlocked a mutex that wasn't locked");
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
+}
+
+ZTEST_USER_OR_NOT(mutex_complex, test_futex_forged_owner)
+{
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	int rv;
+
+	/* The kernel must not boost a thread the caller has no access to,
+	 * just because its ID was written in the mutex word.
+	 */
+	atomic_set(&forged_owner_mutex.val, (atomic_val_t)&forged_owner_thread);
+
+	rv = sys_mutex_lock(&forged_owner_mutex, K_MSEC(10));
+	zassert_equal(rv, -EPERM, "Waited for a forged owner (%d)", rv);
+
+	/* Initializing the mutex again makes it usable */
+	sys_mutex_init(&forged_owner_mutex);
+
+	rv = sys_mutex_lock(&forged_owner_mutex, K_NO_WAIT);
+	zassert_equal(rv, 0, "Failed to lock reinitialized mutex");
+	zassert_equal(forged_owner_mutex.lock_count, 1U);
+
+	rv = sys_mutex_unlock(&forged_owner_mutex);
+	zassert_equal(rv, 0, "Failed to unlock reinitialized mutex");
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
 }
 
 /*test case main entry*/
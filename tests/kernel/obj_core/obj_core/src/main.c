@@ -40,6 +40,9 @@ static struct k_mbox mbox2;
 static K_CONDVAR_DEFINE(condvar1);
 static struct k_condvar condvar2;
 
+static K_RWLOCK_DEFINE(rwlock1);
+static struct k_rwlock rwlock2;
+
 static K_EVENT_DEFINE(event1);
 static struct k_event event2;
 
@@ -261,6 +264,13 @@ ZTEST(obj_core, test_obj_core_condvar)
 			     K_OBJ_CORE(&condvar1), K_OBJ_CORE(&condvar2));
 }
 
+ZTEST(obj_core, test_obj_core_rwlock)
+{
+	k_rwlock_init(&rwlock2);
+	common_obj_core_test(K_OBJ_TYPE_RWLOCK_ID, "reader/writer lock",
+			     K_OBJ_CORE(&rwlock1), K_OBJ_CORE(&rwlock2));
+}
+
 ZTEST(obj_core, test_obj_core_event)
 {
 	k_event_init(&event2);
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_PIPE_ZERO_COPY
+
+ZTEST_SUITE(k_pipe_zero_copy, NULL, NULL, NULL, NULL, NULL);
+
+#define ZC_PIPE_SIZE 10
+#define ZC_DATA_SIZE 16
+
+static struct k_pipe zc_pipe;
+static uint8_t zc_buffer[ZC_PIPE_SIZE];
+static struct k_thread zc_thread;
+static K_THREAD_STACK_DEFINE(zc_stack, 1024);
+
+static const uint8_t pattern[ZC_DATA_SIZE] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+};
+
+static void thread_readv(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t head[3];
+	uint8_t tail[ZC_DATA_SIZE - sizeof(head)];
+	struct k_pipe_iovec iov[] = {
+		{ head, sizeof(head) },
+		{ NULL, 0 },
+		{ tail, sizeof(tail) },
+	};
+
+	zassert_equal(k_pipe_readv(&zc_pipe, iov, ARRAY_SIZE(iov), K_MSEC(1000)),
+		      ZC_DATA_SIZE);
+	zassert_mem_equal(head, pattern, sizeof(head));
+	zassert_mem_equal(tail, &pattern[sizeof(head)], sizeof(tail));
+}
+
+static void thread_read_claim(void *arg1, void *arg2, void *arg3)
+{
+	uint8_t *data;
+
+	zassert_equal(k_pipe_read_claim(&zc_pipe, &data, ZC_PIPE_SIZE, K_MSEC(1000)), 4);
+	zassert_mem_equal(data, pattern, 4);
+	zassert_ok(k_pipe_read_finish(&zc_pipe, 4));
+}
+
+/**
+ * @brief Test writing and reading several buffers at once
+ * @see k_pipe_writev(), k_pipe_readv()
+ */
+ZTEST(k_pipe_zero_copy, test_writev_readv)
+{
+	uint8_t out[ZC_PIPE_SIZE];
+	struct k_pipe_iovec wiov[] = {
+		{ (void *)pattern, 4 },
+		{ NULL, 0 },
+		{ (void *)&pattern[4], 8 },
+	};
+	struct k_pipe_iovec riov[] = {
+		{ out, 3 },
+		{ &out[3], sizeof(out) - 3 },
+	};
+
+	k_pipe_init(&zc_pipe, zc_buffer, sizeof(zc_buffer));
+
+	/* Only what fits in the ring buffer is written */
+	zassert_equal(k_pipe_writev(&zc_pipe, wiov, ARRAY_SIZE(wiov), K_NO_WAIT),
+		      ZC_PIPE_SIZE);
+	zassert_equal(k_pipe_readv(&zc_pipe, riov, ARRAY_SIZE(riov), K_NO_WAIT),
+		      ZC_PIPE_SIZE);
+	zassert_mem_equal(out, pattern, sizeof(out));
+
+	zassert_equal(k_pipe_readv(&zc_pipe, riov, ARRAY_SIZE(riov), K_NO_WAIT), -EAGAIN);
+	zassert_equal(k_pipe_writev(&zc_pipe, wiov, 0, K_NO_WAIT), 0);
+}
+
+/**
+ * @brief Test that buffers longer than an int in total are rejected
+ * @see k_pipe_writev(), k_pipe_readv()
+ */
+ZTEST(k_pipe_zero_copy, test_writev_readv_too_long)
+{
+	/* Rejected before any of the data is accessed */
+	struct k_pipe_iovec iov[] = {
+		{ zc_buffer, (size_t)INT_MAX / 2 + 1 },
+		{ zc_buffer, (size_t)INT_MAX / 2 + 1 },
+	};
+
+	k_pipe_init(&zc_pipe, zc_buffer, sizeof(zc_buffer));
+
+	zassert_equal(k_pipe_writev(&zc_pipe, iov, ARRAY_SIZE(iov), K_NO_WAIT), -EINVAL);
+	zassert_equal(k_pipe_readv(&zc_pipe, iov, ARRAY_SIZE(iov), K_NO_WAIT), -EINVAL);
+}
+
+/**
+ * @brief Test writing several buffers directly to a waiting reader
+ * @see k_pipe_writev(), k_pipe_readv()
+ */
+ZTEST(k_pipe_zero_copy, test_writev_to_reader)
+{
+	struct k_pipe_iovec wiov[] = {
+		{ (void *)pattern, 5 },
+		{ (void *)&pattern[5], ZC_DATA_SIZE - 5 },
+	};
+	k_tid_t tid;
+
+	k_pipe_init(&zc_pipe, zc_buffer, sizeof(zc_buffer));
+
+	/* More than the ring buffer holds: goes straight to the reader */
+	tid = k_thread_create(&zc_thread, zc_stack, K_THREAD_STACK_SIZEOF(zc_stack),
+			      thread_readv, NULL, NULL, NULL, K_PRIO_COOP(0), 0, K_NO_WAIT);
+	k_msleep(10);
+
+	zassert_equal(k_pipe_writev(&zc_pipe, wiov, ARRAY_SIZE(wiov), K_NO_WAIT),
+		      ZC_DATA_SIZE);
+	k_thread_join(tid, K_FOREVER);
+	zassert_true(ring_buf_is_empty(&zc_pipe.buf));
+}
+
+/**
+ * @brief Test writing to a pipe in place
+ * @see k_pipe_write_claim(), k_pipe_write_finish()
+ */
+ZTEST(k_pipe_zero_copy, test_write_claim)
+{
+	uint8_t *data;
+	uint8_t *other;
+	uint8_t out[ZC_PIPE_SIZE];
+
+	k_pipe_init(&zc_pipe, zc_buffer, sizeof(zc_buffer));
+
+	zassert_equal(k_pipe_write_finish(&zc_pipe, 0), -EINVAL);
+	zassert_equal(k_pipe_write_claim(&zc_pipe, &data, 0, K_NO_WAIT), -EINVAL);
+
+	zassert_equal(k_pipe_write_claim(&zc_pipe, &data, 6, K_NO_WAIT), 6);
+	zassert_equal(k_pipe_write_claim(&zc_pipe, &other, 1, K_NO_WAIT), -EBUSY);
+	/* Other writers wait for the claim to be finished */
+	zassert_equal(k_pipe_write(&zc_pipe, pattern, 1, K_NO_WAIT), -EAGAIN);
+
+	memcpy(data, pattern, 6);
+	zassert_equal(k_pipe_write_finish(&zc_pipe, 7), -EINVAL);
+	zassert_ok(k_pipe_write_finish(&zc_pipe, 4));
+	zassert_equal(k_pipe_write_finish(&zc_pipe, 0), -EINVAL);
+
+	/* The unused part of the claim was given back */
+	zassert_equal(k_pipe_write(&zc_pipe, &pattern[4], 6, K_NO_WAIT), 6);
+	zassert_equal(k_pipe_read(&zc_pipe, out, sizeof(out), K_NO_WAIT), ZC_PIPE_SIZE);
+	zassert_mem_equal(out, pattern, sizeof(out));
+}
+
+/**
+ * @brief Test reading from a pipe in place, across the ring buffer's end
+ * @see k_pipe_read_claim(), k_pipe_read_finish()
+ */
+ZTEST(k_pipe_zero_copy, test_read_claim)
+{
+	uint8_t *data;
+	uint8_t *other;
+	uint8_t out[ZC_PIPE_SIZE];
+
+	k_pipe_init(&zc_pipe, zc_buffer, sizeof(zc_buffer));
+
+	zassert_equal(k_pipe_read_claim(&zc_pipe, &data, 1, K_NO_WAIT), -EAGAIN);
+
+	/* Leave 8 bytes wrapping around the end of the ring buffer */
+	zassert_equal(k_pipe_write(&zc_pipe, pattern, 8, K_NO_WAIT), 8);
+	zassert_equal(k_pipe_read(&zc_pipe, out, 6, K_NO_WAIT), 6);
+	zassert_equal(k_pipe_write(&zc_pipe, &pattern[8], 6, K_NO_WAIT), 6);
+
+	zassert_equal(k_pipe_read_claim(&zc_pipe, &data, 8, K_NO_WAIT), 4);
+	zassert_mem_equal(data, &pattern[6], 4);
+	zassert_equal(k_pipe_read_claim(&zc_pipe, &other, 1, K_NO_WAIT), -EBUSY);
+	/* Other readers wait for the claim to be finished */
+	zassert_equal(k_pipe_read(&zc_pipe, out, 1, K_NO_WAIT), -EAGAIN);
+
+	zassert_equal(k_pipe_read_finish(&zc_pipe, 5), -EINVAL);
+	zassert_ok(k_pipe_read_finish(&zc_pipe, 1));
+	zassert_equal(k_pipe_read_finish(&zc_pipe, 0), -EINVAL);
+
+	/* The unconsumed part of the claim is read again */
+	zassert_equal(k_pipe_read(&zc_pipe, out, sizeof(out), K_NO_WAIT), 7);
+	zassert_mem_equal(out, &pattern[7], 7);
+}
+
+/**
+ * @brief Test waiting for data to claim, and resetting claims
+ * @see k_pipe_read_claim(), k_pipe_reset()
+ */
+ZTEST(k_pipe_zero_copy, test_claim_wait_reset)
+{
+	uint8_t *data;
+	k_tid_t tid;
+
+	k_pipe_init(&zc_pipe, zc_buffer, sizeof(zc_buffer));
+
+	/* The waiting claimer is woken up, the data stays in the ring buffer */
+	tid = k_thread_create(&zc_thread, zc_stack, K_THREAD_STACK_SIZEOF(zc_stack),
+			      thread_read_claim, NULL, NULL, NULL, K_PRIO_COOP(0), 0,
+			      K_NO_WAIT);
+	k_msleep(10);
+
+	zassert_equal(k_pipe_write(&zc_pipe, pattern, 4, K_NO_WAIT), 4);
+	k_thread_join(tid, K_FOREVER);
+	zassert_true(ring_buf_is_empty(&zc_pipe.buf));
+
+	zassert_equal(k_pipe_write_claim(&zc_pipe, &data, 2, K_NO_WAIT), 2);
+	k_pipe_reset(&zc_pipe);
+	zassert_equal(k_pipe_write_finish(&zc_pipe, 2), -EINVAL);
+	zassert_equal(k_pipe_write_claim(&zc_pipe, &data, 2, K_NO_WAIT), 2);
+	zassert_ok(k_pipe_write_finish(&zc_pipe, 0));
+}
+
+#endif /* CONFIG_PIPE_ZERO_COPY */
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#ifdef CONFIG_POLL_SET
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_poll_set set;
+static struct k_poll_set_entry entries[3];
+static struct k_poll_set_entry *ready[3];
+
+static struct k_sem set_sem;
+static struct k_fifo set_fifo;
+static struct k_poll_signal set_signal;
+
+static struct k_thread set_thread;
+static K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+
+static void set_setup(void)
+{
+	k_poll_set_init(&set);
+	k_sem_init(&set_sem, 0, 10);
+	k_fifo_init(&set_fifo);
+	k_poll_signal_init(&set_signal);
+
+	k_poll_event_init(&entries[0].event, K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_sem);
+	k_poll_event_init(&entries[1].event, K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_fifo);
+	k_poll_event_init(&entries[2].event, K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+}
+
+static void set_teardown(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		(void)k_poll_set_remove(&set, &entries[i]);
+	}
+}
+
+/**
+ * @brief Test level-triggered poll set entries
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_level)
+{
+	set_setup();
+
+	zassert_ok(k_poll_set_add(&set, &entries[0], 0));
+	zassert_equal(k_poll_set_add(&set, &entries[0], 0), -EALREADY);
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&set_sem);
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), 1);
+	zassert_equal(ready[0], &entries[0]);
+	zassert_equal(ready[0]->event.state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* Reported again while the semaphore is available */
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), 1);
+	zassert_equal(ready[0], &entries[0]);
+
+	zassert_ok(k_sem_take(&set_sem, K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), -EAGAIN);
+
+	set_teardown();
+}
+
+/**
+ * @brief Test edge-triggered poll set entries
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_edge)
+{
+	static struct set_item {
+		void *reserved;
+	} items[2];
+
+	set_setup();
+
+	zassert_ok(k_poll_set_add(&set, &entries[1], K_POLL_SET_EDGE));
+
+	k_fifo_put(&set_fifo, &items[0]);
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), 1);
+	zassert_equal(ready[0]->event.state, K_POLL_STATE_FIFO_DATA_AVAILABLE);
+
+	/* Data is still queued, but there was no new edge */
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), -EAGAIN);
+
+	k_fifo_put(&set_fifo, &items[1]);
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), 1);
+
+	zassert_not_null(k_fifo_get(&set_fifo, K_NO_WAIT));
+	zassert_not_null(k_fifo_get(&set_fifo, K_NO_WAIT));
+
+	set_teardown();
+}
+
+/**
+ * @brief Test one-shot poll set entries and re-arming them
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_modify(), k_poll_set_remove()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_oneshot)
+{
+	set_setup();
+
+	/* Already signaled when added: reported right away */
+	k_poll_signal_raise(&set_signal, 0);
+	zassert_ok(k_poll_set_add(&set, &entries[2], K_POLL_SET_ONESHOT));
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), 1);
+	zassert_equal(ready[0]->event.state, K_POLL_STATE_SIGNALED);
+
+	k_poll_signal_raise(&set_signal, 0);
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), -EAGAIN);
+
+	zassert_ok(k_poll_set_modify(&set, &entries[2], K_POLL_SET_ONESHOT));
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), 1);
+
+	zassert_ok(k_poll_set_remove(&set, &entries[2]));
+	zassert_equal(k_poll_set_remove(&set, &entries[2]), -EINVAL);
+	zassert_equal(k_poll_set_modify(&set, &entries[2], 0), -EINVAL);
+
+	k_poll_signal_reset(&set_signal);
+	k_poll_signal_raise(&set_signal, 0);
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_NO_WAIT), -EAGAIN);
+
+	set_teardown();
+}
+
+static void set_give_entry(void *p1, void *p2, void *p3)
+{
+	k_msleep(10);
+	k_poll_signal_raise(&set_signal, 0x1337);
+	k_sem_give(&set_sem);
+}
+
+/**
+ * @brief Test waking threads blocked on a poll set and on k_poll()
+ *
+ * A poll set entry and a k_poll() event watch the same signal, both must
+ * be notified when it is raised.
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL,
+							     K_POLL_MODE_NOTIFY_ONLY,
+							     &set_signal);
+	int count;
+
+	set_setup();
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		zassert_ok(k_poll_set_add(&set, &entries[i], K_POLL_SET_EDGE));
+	}
+
+	k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			set_give_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_ok(k_poll(&event, 1, K_MSEC(1000)));
+	zassert_equal(event.state, K_POLL_STATE_SIGNALED);
+
+	k_thread_join(&set_thread, K_FOREVER);
+
+	count = k_poll_set_wait(&set, ready, 3, K_MSEC(1000));
+	zassert_equal(count, 2);
+	zassert_equal(ready[0], &entries[2]);
+	zassert_equal(ready[1], &entries[0]);
+
+	/* Nothing else becomes ready */
+	zassert_equal(k_poll_set_wait(&set, ready, 3, K_MSEC(10)), -EAGAIN);
+
+	k_poll_signal_reset(&set_signal);
+	k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			set_give_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	/* Blocks until the signal is raised, then returns it alone */
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_MSEC(1000)), 1);
+	zassert_equal(ready[0], &entries[2]);
+
+	k_thread_join(&set_thread, K_FOREVER);
+	zassert_ok(k_sem_take(&set_sem, K_NO_WAIT));
+	zassert_ok(k_sem_take(&set_sem, K_NO_WAIT));
+
+	set_teardown();
+}
+
+#endif /* CONFIG_POLL_SET */
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#define PRIO_LOW   K_PRIO_PREEMPT(10)
+#define PRIO_HIGH  K_PRIO_PREEMPT(5)
+
+#define TIMEOUT_MS 100
+
+K_RWLOCK_DEFINE(rwlock);
+
+static struct k_thread threads[2];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2, STACK_SIZE);
+
+static ZTEST_BMEM int thread_ret[2];
+static ZTEST_BMEM bool thread_done[2];
+
+static void read_lock_entry(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	k_timeout_t timeout = SYS_TIMEOUT_MS(POINTER_TO_INT(p2));
+
+	ARG_UNUSED(p3);
+
+	thread_ret[id] = k_rwlock_read_lock(&rwlock, timeout);
+	thread_done[id] = true;
+}
+
+static void write_lock_entry(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+	k_timeout_t timeout = SYS_TIMEOUT_MS(POINTER_TO_INT(p2));
+
+	ARG_UNUSED(p3);
+
+	thread_ret[id] = k_rwlock_write_lock(&rwlock, timeout);
+	thread_done[id] = true;
+
+	if (thread_ret[id] == 0) {
+		zassert_ok(k_rwlock_write_unlock(&rwlock));
+	}
+}
+
+static void write_unlock_entry(void *p1, void *p2, void *p3)
+{
+	int id = POINTER_TO_INT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	thread_ret[id] = k_rwlock_write_unlock(&rwlock);
+	thread_done[id] = true;
+}
+
+static void spawn(int id, k_thread_entry_t entry, int timeout_ms, int prio)
+{
+	/* Spawned threads preempt the test thread as soon as they are created */
+	k_thread_priority_set(k_current_get(), PRIO_LOW);
+
+	thread_ret[id] = INT_MAX;
+	thread_done[id] = false;
+	k_thread_create(&threads[id], stacks[id], STACK_SIZE, entry,
+			INT_TO_POINTER(id), INT_TO_POINTER(timeout_ms), NULL,
+			prio, K_INHERIT_PERMS | K_USER, K_NO_WAIT);
+}
+
+/**
+ * @brief Test that several threads can hold the lock for reading at once
+ */
+ZTEST(rwlock_api, test_concurrent_readers)
+{
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+
+	/* A second reader is admitted without waiting */
+	spawn(0, read_lock_entry, 0, PRIO_HIGH);
+	k_thread_join(&threads[0], K_FOREVER);
+	zassert_true(thread_done[0]);
+	zassert_ok(thread_ret[0]);
+
+	/* Readers are counted, not owned: drop both read locks */
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_equal(k_rwlock_read_unlock(&rwlock), -EINVAL);
+}
+
+/**
+ * @brief Test that a writer excludes both readers and other writers
+ */
+ZTEST(rwlock_api, test_writer_exclusion)
+{
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EDEADLK);
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EDEADLK);
+
+	spawn(0, read_lock_entry, 0, PRIO_HIGH);
+	k_thread_join(&threads[0], K_FOREVER);
+	zassert_equal(thread_ret[0], -EBUSY);
+
+	spawn(0, write_lock_entry, 0, PRIO_HIGH);
+	k_thread_join(&threads[0], K_FOREVER);
+	zassert_equal(thread_ret[0], -EBUSY);
+
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EINVAL);
+
+	/* Readers keep writers out */
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_write_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_unlock(&rwlock), -EINVAL);
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that only the writer can release a write lock
+ */
+ZTEST(rwlock_api, test_write_unlock_not_owner)
+{
+	spawn(0, write_lock_entry, TIMEOUT_MS, PRIO_HIGH);
+	k_thread_join(&threads[0], K_FOREVER);
+	zassert_ok(thread_ret[0]);
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	spawn(1, write_unlock_entry, 0, PRIO_HIGH);
+	k_thread_join(&threads[1], K_FOREVER);
+	zassert_equal(thread_ret[1], -EPERM);
+
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that a waiting writer holds back new readers
+ */
+ZTEST(rwlock_api, test_writer_preference)
+{
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+
+	/* The writer waits for the current reader */
+	spawn(0, write_lock_entry, -1, PRIO_HIGH);
+	zassert_false(thread_done[0]);
+
+	/* ... and a new reader waits for the writer */
+	zassert_equal(k_rwlock_read_lock(&rwlock, K_NO_WAIT), -EBUSY);
+	spawn(1, read_lock_entry, -1, PRIO_HIGH);
+	zassert_false(thread_done[1]);
+
+	/* Releasing the read lock runs the writer first, then the reader */
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	k_thread_join(&threads[0], K_FOREVER);
+	k_thread_join(&threads[1], K_FOREVER);
+	zassert_ok(thread_ret[0]);
+	zassert_ok(thread_ret[1]);
+
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that a writer timing out admits the readers it held back
+ */
+ZTEST(rwlock_api, test_write_lock_timeout)
+{
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, write_lock_entry, TIMEOUT_MS, PRIO_HIGH);
+	spawn(1, read_lock_entry, -1, PRIO_HIGH);
+	zassert_false(thread_done[0]);
+	zassert_false(thread_done[1]);
+
+	k_thread_join(&threads[0], K_FOREVER);
+	zassert_equal(thread_ret[0], -EAGAIN);
+
+	k_thread_join(&threads[1], K_FOREVER);
+	zassert_ok(thread_ret[1]);
+
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that a reader times out while a writer holds the lock
+ */
+ZTEST(rwlock_api, test_read_lock_timeout)
+{
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	spawn(0, read_lock_entry, TIMEOUT_MS, PRIO_HIGH);
+	k_thread_join(&threads[0], K_FOREVER);
+	zassert_equal(thread_ret[0], -EAGAIN);
+
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+}
+
+/**
+ * @brief Test that the writer inherits the priority of waiting threads
+ */
+ZTEST(rwlock_api_pi, test_priority_inheritance)
+{
+	k_tid_t self = k_current_get();
+
+	if (!IS_ENABLED(CONFIG_RWLOCK_PRIORITY_INHERITANCE)) {
+		ztest_test_skip();
+	}
+
+	k_thread_priority_set(self, PRIO_LOW);
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+
+	/* A higher priority reader boosts the writer */
+	spawn(0, read_lock_entry, -1, PRIO_HIGH);
+	zassert_false(thread_done[0]);
+	zassert_equal(k_thread_priority_get(self), PRIO_HIGH);
+
+	/* The original priority is restored on release */
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+	zassert_equal(k_thread_priority_get(self), PRIO_LOW);
+	k_thread_join(&threads[0], K_FOREVER);
+	zassert_ok(thread_ret[0]);
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+
+	/* A waiter timing out drops the boost */
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_NO_WAIT));
+	spawn(0, write_lock_entry, TIMEOUT_MS, PRIO_HIGH);
+	zassert_equal(k_thread_priority_get(self), PRIO_HIGH);
+	k_thread_join(&threads[0], K_FOREVER);
+	zassert_equal(thread_ret[0], -EAGAIN);
+	zassert_equal(k_thread_priority_get(self), PRIO_LOW);
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+}
+
+/**
+ * @brief Test the lock from user mode
+ */
+ZTEST_USER(rwlock_api, test_user_lock_unlock)
+{
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_FOREVER));
+	zassert_ok(k_rwlock_read_lock(&rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+	zassert_ok(k_rwlock_read_unlock(&rwlock));
+
+	zassert_ok(k_rwlock_write_lock(&rwlock, K_FOREVER));
+	zassert_ok(k_rwlock_write_unlock(&rwlock));
+}
+
+static void *rwlock_api_setup(void)
+{
+	k_thread_access_grant(k_current_get(), &rwlock, &threads[0], &threads[1],
+			      &stacks[0], &stacks[1]);
+
+	return NULL;
+}
+
+ZTEST_SUITE(rwlock_api, NULL, rwlock_api_setup, NULL, NULL, NULL);
+ZTEST_SUITE(rwlock_api_pi, NULL, rwlock_api_setup, NULL, NULL, NULL);
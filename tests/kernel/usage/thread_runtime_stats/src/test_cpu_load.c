@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_SCHED_CPU_LOAD
+
+#define LOAD_PHASE_MS 1000
+
+/**
+ * @brief Test the CPU load averages
+ *
+ * The CPU idles, then is kept busy for one second, the time constant of the
+ * shortest average, which should then be close to 63%, and idles again. The
+ * idle phases span a tickless idle without any context switch, accounted for
+ * when the loads are read.
+ *
+ * @see k_cpu_load_get(), k_thread_runtime_stats_cpu_get()
+ */
+ZTEST(usage_api, test_cpu_load)
+{
+	struct k_cpu_load_stats idle;
+	struct k_cpu_load_stats busy;
+	struct k_cpu_load_stats after;
+	k_thread_runtime_stats_t cpu_stats;
+
+	k_msleep(LOAD_PHASE_MS);
+	zassert_ok(k_cpu_load_get(0, &idle));
+
+	k_busy_wait(LOAD_PHASE_MS * USEC_PER_MSEC);
+	zassert_ok(k_cpu_load_get(0, &busy));
+
+	zassert_true(busy.avg_1s > idle.avg_1s, "1s load did not rise");
+	zassert_true(busy.avg_1s >= 500 && busy.avg_1s <= 1000,
+		     "unexpected 1s load %u", busy.avg_1s);
+	zassert_true(busy.avg_1s > busy.avg_60s,
+		     "60s load %u not slower than 1s load %u",
+		     busy.avg_60s, busy.avg_1s);
+
+	k_msleep(LOAD_PHASE_MS);
+	zassert_ok(k_cpu_load_get(0, &after));
+	zassert_true(after.avg_1s < busy.avg_1s, "1s load did not decay");
+
+	zassert_ok(k_thread_runtime_stats_cpu_get(0, &cpu_stats));
+	zassert_true(cpu_stats.load.avg_60s <= 1000);
+
+	zassert_equal(k_cpu_load_get(CONFIG_MP_MAX_NUM_CPUS, &after), -EINVAL);
+	zassert_equal(k_cpu_load_get(0, NULL), -EINVAL);
+}
+
+#endif /* CONFIG_SCHED_CPU_LOAD */
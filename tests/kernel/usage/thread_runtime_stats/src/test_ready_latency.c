@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_SCHED_THREAD_READY_LATENCY
+
+#define LATENCY_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define LATENCY_BUSY_US    2000
+
+static struct k_thread latency_thread;
+static K_THREAD_STACK_DEFINE(latency_stack, LATENCY_STACK_SIZE);
+
+static void latency_helper(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+}
+
+static uint32_t bucket_sum(const struct k_ready_latency_stats *stats)
+{
+	uint32_t sum = 0U;
+
+	for (unsigned int i = 0; i < CONFIG_SCHED_THREAD_READY_LATENCY_BUCKETS; i++) {
+		sum += stats->buckets[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Test the ready-to-run latency statistics
+ *
+ * A lower priority thread is readied while the test thread keeps the CPU
+ * busy: its latency covers the busy wait, and is accounted to the CPU too.
+ *
+ * @see k_thread_runtime_stats_get(), k_thread_runtime_stats_cpu_get()
+ */
+ZTEST(usage_api, test_thread_ready_latency)
+{
+	k_thread_runtime_stats_t thread_stats;
+	k_thread_runtime_stats_t cpu_before;
+	k_thread_runtime_stats_t cpu_after;
+	uint32_t busy_cycles = k_us_to_cyc_floor32(LATENCY_BUSY_US);
+	k_tid_t tid;
+
+	zassert_ok(k_thread_runtime_stats_cpu_get(0, &cpu_before));
+
+	tid = k_thread_create(&latency_thread, latency_stack,
+			      K_THREAD_STACK_SIZEOF(latency_stack),
+			      latency_helper, NULL, NULL, NULL,
+			      K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+
+	/* The helper is ready, but can only run once we block */
+	k_busy_wait(LATENCY_BUSY_US);
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_ok(k_thread_runtime_stats_get(tid, &thread_stats));
+	zassert_equal(thread_stats.ready_latency.count, 1);
+	zassert_true(thread_stats.ready_latency.longest >= busy_cycles);
+	zassert_equal(thread_stats.ready_latency.total, thread_stats.ready_latency.longest);
+	zassert_equal(bucket_sum(&thread_stats.ready_latency), 1);
+
+	zassert_ok(k_thread_runtime_stats_cpu_get(0, &cpu_after));
+	zassert_true(cpu_after.ready_latency.count > cpu_before.ready_latency.count);
+	zassert_true(cpu_after.ready_latency.longest >= busy_cycles);
+	zassert_equal(bucket_sum(&cpu_after.ready_latency), cpu_after.ready_latency.count);
+}
+
+#endif /* CONFIG_SCHED_THREAD_READY_LATENCY */
@@ -1442,6 +1442,87 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+static struct k_work_delayable batch_dworks[3];
+static struct k_work_delayable *const batch_ptrs[] = {
+	&batch_dworks[0], &batch_dworks[1], &batch_dworks[2],
+};
+static atomic_t batch_order[ARRAY_SIZE(batch_dworks)];
+static atomic_t batch_seq;
+
+static void batch_handler(struct k_work *work)
+{
+	struct k_work_delayable *dw = k_work_delayable_from_work(work);
+
+	atomic_set(&batch_order[dw - batch_dworks], atomic_inc(&batch_seq));
+}
+
+static void batch_init(void)
+{
+	atomic_clear(&batch_seq);
+	for (int i = 0; i < ARRAY_SIZE(batch_dworks); i++) {
+		k_work_init_delayable(&batch_dworks[i], batch_handler);
+		atomic_set(&batch_order[i], -1);
+	}
+}
+
+ZTEST(work_1cpu, test_1cpu_batch_reschedule)
+{
+	const k_timeout_t delays[] = {
+		K_MSEC(3 * DELAY_MS), K_MSEC(DELAY_MS), K_NO_WAIT,
+	};
+	int rc;
+
+	batch_init();
+
+	/* Schedule far out, so the batch has to replace the deadlines */
+	for (int i = 0; i < ARRAY_SIZE(batch_dworks); i++) {
+		rc = k_work_schedule_for_queue(&coophi_queue, batch_ptrs[i],
+					       K_MSEC(10 * DELAY_MS));
+		zassert_equal(rc, 1);
+	}
+
+	rc = k_work_reschedule_batch(&coophi_queue, batch_ptrs, delays,
+				     ARRAY_SIZE(batch_ptrs));
+	zassert_equal(rc, 3);
+	zassert_equal(k_work_delayable_busy_get(batch_ptrs[0]), K_WORK_DELAYED);
+	zassert_equal(k_work_delayable_busy_get(batch_ptrs[1]), K_WORK_DELAYED);
+	zassert_equal(k_work_delayable_busy_get(batch_ptrs[2]), K_WORK_QUEUED);
+
+	/* The items run in the order of their new deadlines */
+	k_sleep(K_MSEC(4 * DELAY_MS));
+	zassert_equal(atomic_get(&batch_seq), 3);
+	zassert_equal(atomic_get(&batch_order[0]), 2);
+	zassert_equal(atomic_get(&batch_order[1]), 1);
+	zassert_equal(atomic_get(&batch_order[2]), 0);
+
+	for (int i = 0; i < ARRAY_SIZE(batch_dworks); i++) {
+		zassert_equal(k_work_delayable_busy_get(batch_ptrs[i]), 0);
+	}
+}
+
+ZTEST(work_1cpu, test_1cpu_batch_cancel)
+{
+	int rc;
+
+	batch_init();
+
+	rc = k_work_schedule_for_queue(&coophi_queue, batch_ptrs[0], K_MSEC(DELAY_MS));
+	zassert_equal(rc, 1);
+	rc = k_work_schedule_for_queue(&coophi_queue, batch_ptrs[1], K_NO_WAIT);
+	zassert_equal(rc, 1);
+
+	/* Scheduled, queued and idle items are all canceled at once */
+	rc = k_work_cancel_delayable_batch(batch_ptrs, ARRAY_SIZE(batch_ptrs));
+	zassert_equal(rc, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(batch_dworks); i++) {
+		zassert_equal(k_work_delayable_busy_get(batch_ptrs[i]), 0);
+	}
+
+	k_sleep(K_MSEC(2 * DELAY_MS));
+	zassert_equal(atomic_get(&batch_seq), 0);
+}
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 Renesas Electronics Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_WORKERS 2
+#define POOL_PRIO   K_PRIO_PREEMPT(1)
+
+#define TIMEOUT K_MSEC(1000)
+
+static struct k_work_q pool;
+static K_THREAD_STACK_DEFINE(pool_stack, STACK_SIZE);
+
+static struct k_work_q_worker workers[NUM_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NUM_WORKERS, STACK_SIZE);
+
+static struct k_work block_work;
+static struct k_work test_work;
+static struct k_work_delayable test_dwork;
+
+/* Work synchronization objects must be in cache-coherent memory,
+ * which excludes stacks on some architectures.
+ */
+static struct k_work_sync work_sync;
+
+static K_SEM_DEFINE(rel_sem, 0, 1);
+static K_SEM_DEFINE(block_sem, 0, 1);
+static K_SEM_DEFINE(sync_sem, 0, 10);
+
+static struct k_thread drain_thread;
+static K_THREAD_STACK_DEFINE(drain_stack, STACK_SIZE);
+
+static k_tid_t block_thread;
+static k_tid_t test_thread;
+
+static atomic_t active;
+static atomic_t max_active;
+static atomic_t runs;
+
+static void pool_start(void)
+{
+	k_work_queue_start(&pool, pool_stack, K_THREAD_STACK_SIZEOF(pool_stack),
+			   POOL_PRIO, NULL);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		/* The first worker serves CPU 0, the others any CPU */
+		zassert_ok(k_work_queue_add_worker(&pool, &workers[i], worker_stacks[i],
+						   K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+						   (i == 0) ? 0 : -1));
+	}
+}
+
+/* Blocks the thread that runs it until rel_sem is given */
+static void block_handler(struct k_work *work)
+{
+	block_thread = k_current_get();
+	k_sem_give(&block_sem);
+	k_sem_take(&rel_sem, K_FOREVER);
+}
+
+static void test_handler(struct k_work *work)
+{
+	test_thread = k_current_get();
+	k_sem_give(&sync_sem);
+}
+
+/* Takes a while to run, and records how many instances run at once */
+static void slow_handler(struct k_work *work)
+{
+	atomic_val_t now = atomic_inc(&active) + 1;
+
+	if (now > atomic_get(&max_active)) {
+		atomic_set(&max_active, now);
+	}
+
+	k_sem_give(&sync_sem);
+	k_msleep(50);
+
+	atomic_inc(&runs);
+	atomic_dec(&active);
+}
+
+static void block_pool(void)
+{
+	k_work_init(&block_work, block_handler);
+	zassert_equal(k_work_submit_to_queue_cpu(&pool, &block_work, 0), 1);
+	zassert_ok(k_sem_take(&block_sem, TIMEOUT));
+}
+
+static void unblock_pool(void)
+{
+	k_sem_give(&rel_sem);
+	(void)k_work_flush(&block_work, &work_sync);
+}
+
+/**
+ * @brief Test that a blocked handler does not hold back other work
+ */
+ZTEST(work_pool, test_blocked_handler)
+{
+	block_pool();
+
+	k_work_init(&test_work, test_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), 1);
+	zassert_ok(k_sem_take(&sync_sem, TIMEOUT));
+	zassert_not_equal(test_thread, block_thread);
+
+	unblock_pool();
+	zassert_equal(k_work_busy_get(&block_work), 0);
+}
+
+/**
+ * @brief Test that work preferring a busy CPU is stolen by another worker
+ */
+ZTEST(work_pool, test_cpu_steal)
+{
+	block_pool();
+
+	k_work_init(&test_work, test_handler);
+	zassert_equal(k_work_submit_to_queue_cpu(&pool, &test_work, 0), 1);
+	zassert_ok(k_sem_take(&sync_sem, TIMEOUT));
+	zassert_not_equal(test_thread, block_thread);
+
+	unblock_pool();
+}
+
+/**
+ * @brief Test that a work item resubmitted while running is not re-entered
+ */
+ZTEST(work_pool, test_no_reentrancy)
+{
+	atomic_clear(&active);
+	atomic_clear(&max_active);
+	atomic_clear(&runs);
+
+	k_work_init(&test_work, slow_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), 1);
+	zassert_ok(k_sem_take(&sync_sem, TIMEOUT));
+
+	/* Running: the resubmission waits for the running instance */
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), 2);
+	zassert_equal(k_work_busy_get(&test_work), K_WORK_RUNNING | K_WORK_QUEUED);
+
+	zassert_true(k_work_flush(&test_work, &work_sync));
+	zassert_equal(k_work_busy_get(&test_work), 0);
+	zassert_equal(atomic_get(&runs), 2);
+	zassert_equal(atomic_get(&max_active), 1);
+	k_sem_reset(&sync_sem);
+}
+
+/**
+ * @brief Test cancelling a running work item on a pool
+ */
+ZTEST(work_pool, test_cancel_sync)
+{
+	atomic_clear(&runs);
+
+	k_work_init(&test_work, slow_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), 1);
+	zassert_ok(k_sem_take(&sync_sem, TIMEOUT));
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), 2);
+
+	/* The queued instance is dropped, the running one completes */
+	zassert_true(k_work_cancel_sync(&test_work, &work_sync));
+	zassert_equal(k_work_busy_get(&test_work), 0);
+	zassert_equal(atomic_get(&runs), 1);
+}
+
+/**
+ * @brief Test scheduling delayable work to a pool
+ */
+ZTEST(work_pool, test_schedule)
+{
+	k_work_init_delayable(&test_dwork, test_handler);
+	zassert_equal(k_work_schedule_for_queue(&pool, &test_dwork, K_MSEC(10)), 1);
+	zassert_ok(k_sem_take(&sync_sem, TIMEOUT));
+	(void)k_work_flush_delayable(&test_dwork, &work_sync);
+	zassert_equal(k_work_delayable_busy_get(&test_dwork), 0);
+}
+
+/**
+ * @brief Test draining and stopping all threads of a pool
+ */
+ZTEST(work_pool, test_drain_stop)
+{
+	k_work_init(&test_work, slow_handler);
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), 1);
+
+	zassert_equal(k_work_queue_drain(&pool, true), 1);
+	zassert_equal(k_work_busy_get(&test_work), 0);
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), -EBUSY);
+	k_sem_reset(&sync_sem);
+
+	zassert_ok(k_work_queue_stop(&pool, TIMEOUT));
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), -ENODEV);
+	zassert_equal(k_work_queue_add_worker(&pool, &workers[0], worker_stacks[0],
+					      K_THREAD_STACK_SIZEOF(worker_stacks[0]), -1),
+		      -ENODEV);
+
+	/* A stopped pool can be started again */
+	pool_start();
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), 1);
+	zassert_true(k_work_flush(&test_work, &work_sync));
+	k_sem_reset(&sync_sem);
+}
+
+static void drain_entry(void *p1, void *p2, void *p3)
+{
+	(void)k_work_queue_drain(&pool, true);
+}
+
+/**
+ * @brief Test a pool that does not stop within the timeout
+ */
+ZTEST(work_pool, test_stop_timeout)
+{
+	k_work_init(&test_work, test_handler);
+	block_pool();
+
+	/* Plug the pool, the drain waits for the blocked handler */
+	k_thread_create(&drain_thread, drain_stack, K_THREAD_STACK_SIZEOF(drain_stack),
+			drain_entry, NULL, NULL, NULL, POOL_PRIO, 0, K_NO_WAIT);
+	k_msleep(10);
+
+	zassert_equal(k_work_queue_stop(&pool, K_MSEC(10)), -ETIMEDOUT);
+
+	/* The pool keeps stopping, with its idle threads gone */
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), -EBUSY);
+	zassert_equal(k_work_queue_add_worker(&pool, &workers[0], worker_stacks[0],
+					      K_THREAD_STACK_SIZEOF(worker_stacks[0]), -1),
+		      -EBUSY);
+	zassert_equal(k_work_queue_stop(&pool, K_MSEC(10)), -ETIMEDOUT);
+
+	/* The last thread exits once done with its work */
+	k_sem_give(&rel_sem);
+	zassert_ok(k_thread_join(&drain_thread, TIMEOUT));
+	zassert_ok(k_thread_join(&pool.thread, TIMEOUT));
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		zassert_ok(k_thread_join(&workers[i].thread, TIMEOUT));
+	}
+
+	zassert_equal(k_work_queue_stop(&pool, TIMEOUT), -EALREADY);
+	zassert_equal(k_work_submit_to_queue(&pool, &test_work), -ENODEV);
+
+	pool_start();
+}
+
+static void *work_pool_setup(void)
+{
+	k_work_queue_init(&pool);
+	pool_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(work_pool, NULL, work_pool_setup, NULL, NULL, NULL);
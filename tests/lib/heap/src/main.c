@@ -8,6 +8,7 @@
 #include <zephyr/sys/sys_heap.h>
 #include <zephyr/sys/heap_listener.h>
 #include <inttypes.h>
+#include <heap.h>
 
 /* Guess at a value for heap size based on available memory on the
  * platform, with workarounds.
@@ -41,15 +42,6 @@
 #define BIG_HEAP_SZ MIN(256 * 1024, MEMSZ / 3)
 #define SMALL_HEAP_SZ MIN(BIG_HEAP_SZ, 2048)
 
-/* With enabling SYS_HEAP_RUNTIME_STATS, the size of struct z_heap
- * will increase 16 bytes on 64 bit CPU.
- */
-#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
-#define SOLO_FREE_HEADER_HEAP_SZ (80)
-#else
-#define SOLO_FREE_HEADER_HEAP_SZ (64)
-#endif
-
 #define SCRATCH_SZ (sizeof(heapmem) / 2)
 
 /* The test memory.  Make them pointer arrays for robust alignment
@@ -154,10 +146,20 @@ static void log_result(size_t sz, struct z_heap_stress_result *r)
 	uint32_t succ_pct = ((100ULL * r->successful_allocs + r->total_allocs / 2)
 			  / r->total_allocs);
 
+	uint32_t failed = r->total_allocs - r->successful_allocs;
+	uint32_t fail_pct = (failed == 0) ? 0 :
+		(uint32_t)((100ULL * r->accumulated_failed_in_use_bytes / failed + sz / 2) / sz);
+
 	TC_PRINT("successful allocs: %d/%d (%d%%), frees: %d,"
 		 "  avg usage: %d/%d (%d%%)\n",
 		 r->successful_allocs, r->total_allocs, succ_pct,
 		 r->total_frees, avg, (int) sz, avg_pct);
+	TC_PRINT("avg usage at failed alloc: %d%%, alloc cycles avg/max: %d/%d,"
+		 " free cycles avg/max: %d/%d\n", fail_pct,
+		 (uint32_t)(r->accumulated_alloc_cycles / r->total_allocs),
+		 r->max_alloc_cycles,
+		 (uint32_t)(r->accumulated_free_cycles / MAX(r->total_frees, 1)),
+		 r->max_free_cycles);
 }
 
 /* Do a heavy test over a small heap, with many iterations that need
@@ -211,6 +213,29 @@ ZTEST(lib_heap, test_fragmentation)
 	log_result(SMALL_HEAP_SZ, &result);
 }
 
+/* Small object workload, as generated by JSON/CoAP style parsers:
+ * every request is 1..64 bytes.  Run it with and without
+ * CONFIG_SYS_HEAP_SIZE_CLASSES to compare fragmentation and latency.
+ */
+ZTEST(lib_heap, test_small_objects)
+{
+	struct sys_heap heap;
+	struct z_heap_stress_result result;
+
+	TC_PRINT("Testing small objects in a (%d byte) heap\n",
+		 (int) SMALL_HEAP_SZ);
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+	zassert_true(sys_heap_validate(&heap), "");
+	sys_heap_stress_small(testalloc, testfree, &heap,
+			      SMALL_HEAP_SZ, ITERATION_COUNT,
+			      scratchmem, sizeof(scratchmem),
+			      90, 64, &result);
+
+	log_result(SMALL_HEAP_SZ, &result);
+	zassert_true(sys_heap_validate(&heap), "");
+}
+
 /* The heap block format changes for heaps with more than 2^15 chunks,
  * so test that case too.  This can be too large to iterate over
  * exhaustively with good performance, so the relative operation count
@@ -238,9 +263,38 @@ ZTEST(lib_heap, test_big_heap)
 	log_result(BIG_HEAP_SZ, &result);
 }
 
+/* Size of a heap leaving exactly one solo free header after chunk0
+ * and a one byte allocation.  chunk0 holds struct z_heap (which grows
+ * with runtime stats and size classes) and the buckets, whose count
+ * depends on the heap size itself, so look for the bucket count the
+ * resulting heap agrees with.
+ */
+static size_t solo_free_header_heap_sz(void)
+{
+	for (unsigned int nb = 1U; nb < 32U; nb++) {
+		struct z_heap h = { 0 };
+		chunksz_t chunk0 = chunksz(sizeof(struct z_heap) +
+					   nb * sizeof(struct z_heap_bucket));
+		chunksz_t heap_sz;
+
+		/* chunk0, the allocation and the solo free header */
+		h.end_chunk = chunk0 + 1U;
+		heap_sz = chunk0 + bytes_to_chunksz(&h, 1) + 1U;
+		h.end_chunk = heap_sz;
+
+		if (bucket_idx(&h, heap_sz) + 1 == nb) {
+			return heap_sz * CHUNK_UNIT +
+			       heap_footer_bytes(heap_sz * CHUNK_UNIT);
+		}
+	}
+
+	return 0;
+}
+
 /* Test a heap with a solo free header.  A solo free header can exist
  * only on a heap with 64 bit CPU (or chunk_header_bytes() == 8).
- * With 64 bytes heap and 1 byte allocation on a big heap, we get:
+ * With a 64 bytes heap (no runtime stats nor size classes) and 1 byte
+ * allocation on a big heap, we get:
  *
  *   0   1   2   3   4   5   6   7
  * | h | h | b | b | c | 1 | s | f |
@@ -259,7 +313,7 @@ ZTEST(lib_heap, test_solo_free_header)
 
 	TC_PRINT("Testing solo free header in a heap\n");
 
-	sys_heap_init(&heap, heapmem, SOLO_FREE_HEADER_HEAP_SZ);
+	sys_heap_init(&heap, heapmem, solo_free_header_heap_sz());
 	if (sizeof(void *) > 4U) {
 		sys_heap_alloc(&heap, 1);
 		zassert_true(sys_heap_validate(&heap), "");
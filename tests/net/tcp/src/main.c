@@ -42,6 +42,8 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
 /* Data (1280 bytes) to be sent */
 static const char lorem_ipsum[] = LOREM_IPSUM;
 
+#define GSO_DATA_LEN (sizeof(lorem_ipsum) - 1)
+
 static struct in_addr my_addr  = { { { 192, 0, 2, 1 } } };
 static struct sockaddr_in my_addr_s = {
 	.sin_family = AF_INET,
@@ -114,6 +116,10 @@ static enum test_case_no {
 	TEST_CLIENT_CLOSING_FAILURE_IPV6 = 16,
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
+	TEST_CLIENT_GSO_IPV4 = 19,
+	TEST_SERVER_GRO_IPV6 = 20,
+	TEST_CLIENT_SACK_IPV4 = 21,
+	TEST_CLIENT_TLP_IPV4 = 22,
 } test_case_no;
 
 static enum test_state t_state;
@@ -138,6 +144,9 @@ static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
+static void handle_client_gso_test(struct net_pkt *pkt, struct tcphdr *th);
+static void handle_server_gro_test(struct tcphdr *th);
+static void handle_client_sack_test(struct net_pkt *pkt, struct tcphdr *th);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -235,6 +244,16 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* Options of the segments following the SYN */
+static uint8_t tcp_ts_options[12] = {
+	0x01, 0x01, /* NOP */
+	0x08, 0x0a, 0xc2, 0x7b, 0xef, 0x10, 0x00, 0x00, 0x00, 0x00, /* Time */
+};
+
+/* Options sent by the peer in the SACK test cases */
+static uint8_t sack_options[4 + NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE];
+static uint8_t sack_options_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -245,11 +264,20 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
+	const uint8_t *opts = NULL;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) {
+		opts = tcp_ts_options;
+		opts_len = sizeof(tcp_ts_options);
+	} else if (test_case_no == TEST_CLIENT_SACK_IPV4 ||
+		   test_case_no == TEST_CLIENT_TLP_IPV4) {
+		opts = sack_options;
+		opts_len = sack_options_len;
 	}
 
 	/* Allocate buffer */
@@ -284,14 +312,18 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
-	th->th_win = NET_IPV6_MTU;
+
+	if (test_case_no == TEST_CLIENT_GSO_IPV4 ||
+	    test_case_no == TEST_CLIENT_SACK_IPV4 ||
+	    test_case_no == TEST_CLIENT_TLP_IPV4) {
+		/* Let all the data be sent at once */
+		th->th_win = htons(GSO_DATA_LEN);
+	} else {
+		th->th_win = NET_IPV6_MTU;
+	}
 	th->th_seq = htonl(seq);
 
 	if (ACK & flags) {
@@ -303,9 +335,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -490,6 +522,16 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_FIN_ACK_WITH_DATA:
 		handle_client_fin_ack_with_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_CLIENT_GSO_IPV4:
+		handle_client_gso_test(pkt, &th);
+		break;
+	case TEST_SERVER_GRO_IPV6:
+		handle_server_gro_test(&th);
+		break;
+	case TEST_CLIENT_SACK_IPV4:
+	case TEST_CLIENT_TLP_IPV4:
+		handle_client_sack_test(pkt, &th);
+		break;
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -865,6 +907,10 @@ ZTEST(net_tcp, test_server_ipv4)
 	 */
 	test_sem_take(K_MSEC(100), __LINE__);
 
+	mss = conn_mss((struct tcp *)accepted_ctx->tcp);
+	zassert_equal(mss, MIN(0x05b4, net_tcp_get_supported_mss(accepted_ctx->tcp)),
+		      "MSS option of the SYN not used");
+
 	/* Trigger the peer to send DATA  */
 	k_work_reschedule(&test_server, K_NO_WAIT);
 
@@ -873,6 +919,13 @@ ZTEST(net_tcp, test_server_ipv4)
 		zassert_true(false, "Failed to recv data from peer");
 	}
 
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	/* The data came with other options, the MSS of the SYN stays */
+	zassert_equal(conn_mss((struct tcp *)accepted_ctx->tcp), mss,
+		      "MSS lost with the options of the data");
+
 	/* Trigger the peer to send FIN after timeout */
 	k_work_reschedule(&test_server, K_NO_WAIT);
 
@@ -887,7 +940,8 @@ ZTEST(net_tcp, test_server_ipv4)
  *   Expect SYN with TCP options
  *   send SYN ACK,
  *   expect ACK,
- *   expect DATA,
+ *   expect DATA, with a timestamp option only,
+ *   expect the MSS of the SYN to be kept,
  *   send ACK,
  *   expect FIN,
  *   send FIN ACK,
@@ -897,6 +951,7 @@ ZTEST(net_tcp, test_server_ipv4)
 ZTEST(net_tcp, test_server_with_options_ipv4)
 {
 	struct net_context *ctx;
+	uint16_t mss;
 	int ret;
 
 	t_state = T_SYN;
@@ -934,6 +989,10 @@ ZTEST(net_tcp, test_server_with_options_ipv4)
 	 */
 	test_sem_take(K_MSEC(100), __LINE__);
 
+	mss = conn_mss((struct tcp *)accepted_ctx->tcp);
+	zassert_equal(mss, MIN(0x05b4, net_tcp_get_supported_mss(accepted_ctx->tcp)),
+		      "MSS option of the SYN not used");
+
 	/* Trigger the peer to send DATA  */
 	k_work_reschedule(&test_server, K_NO_WAIT);
 
@@ -942,6 +1001,13 @@ ZTEST(net_tcp, test_server_with_options_ipv4)
 		zassert_true(false, "Failed to recv data from peer");
 	}
 
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	/* The data came with other options, the MSS of the SYN stays */
+	zassert_equal(conn_mss((struct tcp *)accepted_ctx->tcp), mss,
+		      "MSS lost with the options of the data");
+
 	/* Trigger the peer to send FIN after timeout */
 	k_work_reschedule(&test_server, K_NO_WAIT);
 
@@ -1003,6 +1069,10 @@ ZTEST(net_tcp, test_server_ipv6)
 	 */
 	test_sem_take(K_MSEC(100), __LINE__);
 
+	mss = conn_mss((struct tcp *)accepted_ctx->tcp);
+	zassert_equal(mss, MIN(0x05b4, net_tcp_get_supported_mss(accepted_ctx->tcp)),
+		      "MSS option of the SYN not used");
+
 	/* Trigger the peer to send DATA  */
 	k_work_reschedule(&test_server, K_NO_WAIT);
 
@@ -1011,6 +1081,13 @@ ZTEST(net_tcp, test_server_ipv6)
 		zassert_true(false, "Failed to recv data from peer");
 	}
 
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	/* The data came with other options, the MSS of the SYN stays */
+	zassert_equal(conn_mss((struct tcp *)accepted_ctx->tcp), mss,
+		      "MSS lost with the options of the data");
+
 	/* Trigger the peer to send FIN after timeout */
 	k_work_reschedule(&test_server, K_NO_WAIT);
 
@@ -2602,4 +2679,578 @@ ZTEST(net_tcp, test_client_fin_ack_with_data)
 	}
 }
 
+static size_t gso_mss;
+static size_t gso_received;
+static int gso_split_segments;
+
+static void handle_client_gso_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	sa_family_t af = net_pkt_family(pkt);
+	struct net_pkt *reply;
+	size_t len;
+	int ret;
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(th, SYN);
+		seq = 0U;
+		ack = ntohl(th->th_seq) + 1U;
+		reply = prepare_syn_ack_packet(af, htons(MY_PORT),
+					       th->th_sport);
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, ACK);
+		seq++;
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+		      net_pkt_ip_opts_len(pkt) - th->th_off * 4U;
+		zassert_true(len > 0 && len <= gso_mss,
+			     "Invalid segment length %zu", len);
+		zassert_equal(ntohl(th->th_seq), ack, "Segment out of order");
+		gso_received += len;
+		ack += len;
+
+		/* Only the last segment split from a super-segment has
+		 * the push flag, acknowledge the data once it is there.
+		 */
+		if (!(th->th_flags & PSH)) {
+			test_verify_flags(th, ACK);
+			gso_split_segments++;
+			return;
+		}
+
+		test_verify_flags(th, PSH | ACK);
+		reply = prepare_ack_packet(af, htons(MY_PORT), th->th_sport);
+
+		if (gso_received == GSO_DATA_LEN) {
+			t_state = T_FIN;
+			test_sem_give();
+		}
+		break;
+	case T_FIN:
+		test_verify_flags(th, FIN | ACK);
+		ack = ack + 1U;
+		t_state = T_FIN_ACK;
+		reply = prepare_fin_ack_packet(af, htons(MY_PORT),
+					       th->th_sport);
+		break;
+	case T_FIN_ACK:
+		test_verify_flags(th, ACK);
+		test_sem_give();
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	ret = net_recv_data(net_iface, reply);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return;
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+/* Test case scenario IPv4
+ *   send SYN,
+ *   expect SYN ACK,
+ *   send ACK,
+ *   send more than an MSS of data,
+ *   expect the data in MSS sized, in-order segments,
+ *   send ACK for the data up to each segment with PSH,
+ *   send FIN,
+ *   expect FIN ACK,
+ *   send ACK.
+ *   With CONFIG_NET_TCP_GSO, the data must have been split from
+ *   super-segments, which only have PSH on their last segment.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_gso_ipv4)
+{
+	struct net_context *ctx;
+	int ret;
+
+	t_state = T_SYN;
+	test_case_no = TEST_CLIENT_GSO_IPV4;
+	seq = ack = 0;
+	gso_received = 0;
+	gso_split_segments = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	if (ret < 0) {
+		zassert_true(false, "Failed to get net_context");
+	}
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in),
+				  NULL,
+				  K_MSEC(100), NULL);
+	if (ret < 0) {
+		zassert_true(false, "Failed to connect to peer");
+	}
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	gso_mss = conn_mss((struct tcp *)ctx->tcp);
+
+	ret = net_context_send(ctx, lorem_ipsum, GSO_DATA_LEN, NULL,
+			       K_NO_WAIT, NULL);
+	zassert_equal(ret, GSO_DATA_LEN, "Failed to send data to peer");
+
+	/* Peer will release the semaphore after it has acknowledged
+	 * all the data
+	 */
+	test_sem_take(K_MSEC(500), __LINE__);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_GSO)) {
+		zassert_true(gso_split_segments > 0,
+			     "No super-segment was sent");
+	}
+
+	net_context_put(ctx);
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to FIN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+
+#define GRO_SEGMENTS 4
+#define GRO_SEGMENT_LEN 20
+
+static uint32_t gro_expected_ack;
+static size_t gro_recv_len;
+static int gro_recv_calls;
+
+static void handle_server_gro_test(struct tcphdr *th)
+{
+	test_verify_flags(th, ACK);
+
+	/* Peer is done once all the data is acknowledged */
+	if (ntohl(th->th_ack) == gro_expected_ack) {
+		test_sem_give();
+	}
+}
+
+static void test_gro_recv_cb(struct net_context *context,
+			     struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr,
+			     union net_proto_header *proto_hdr,
+			     int status,
+			     void *user_data)
+{
+	if (pkt == NULL) {
+		return;
+	}
+
+	gro_recv_calls++;
+	gro_recv_len += net_pkt_remaining_data(pkt);
+
+	net_pkt_unref(pkt);
+}
+
+/* Test case scenario IPv6
+ *   Expect SYN,
+ *   send SYN ACK,
+ *   expect ACK,
+ *   send a burst of in-order DATA segments, only the last one with PSH,
+ *   expect ACK for all the data,
+ *   send RST.
+ *   With CONFIG_NET_TCP_GRO, the segments queued to the RX thread must be
+ *   passed to the application as a single chunk of data.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_server_gro_ipv6)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	uint32_t data_seq;
+	int ret;
+
+	k_sem_reset(&test_sem);
+
+	ctx = create_server_socket(0, 0);
+
+	test_case_no = TEST_SERVER_GRO_IPV6;
+	gro_recv_len = 0;
+	gro_recv_calls = 0;
+	gro_expected_ack = seq + GRO_SEGMENTS * GRO_SEGMENT_LEN;
+
+	ret = net_context_recv(accepted_ctx, test_gro_recv_cb, K_NO_WAIT, NULL);
+	zassert_equal(ret, 0, "Failed to set recv callback (%d)", ret);
+
+	/* Queue all the segments before the RX thread gets to run */
+	k_sched_lock();
+
+	data_seq = seq;
+	for (int i = 0; i < GRO_SEGMENTS; i++) {
+		uint8_t flags = i == GRO_SEGMENTS - 1 ? PSH | ACK : ACK;
+
+		seq = data_seq + i * GRO_SEGMENT_LEN;
+		pkt = tester_prepare_tcp_pkt(AF_INET6, htons(MY_PORT),
+					     htons(PEER_PORT), flags,
+					     lorem_ipsum + i * GRO_SEGMENT_LEN,
+					     GRO_SEGMENT_LEN);
+		zassert_not_null(pkt, "Cannot create pkt");
+
+		ret = net_recv_data(net_iface, pkt);
+		zassert_equal(ret, 0, "recv data failed (%d)", ret);
+	}
+
+	k_sched_unlock();
+
+	/* Peer will release the semaphore after all the data is acknowledged */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Let the data reach the application */
+	k_msleep(50);
+
+	zassert_equal(gro_recv_len, GRO_SEGMENTS * GRO_SEGMENT_LEN,
+		      "Received %zu bytes", gro_recv_len);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_GRO)) {
+		zassert_equal(gro_recv_calls, 1,
+			      "Data was not coalesced (%d chunks)",
+			      gro_recv_calls);
+	}
+
+	/* Just send a RST packet to abort the underlying connection */
+	seq = gro_expected_ack;
+	pkt = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_equal(ret, 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+/* A small MSS, for many segments to fit in the window */
+#define SACK_PEER_MSS 128
+
+static int sack_segments;
+static uint32_t sack_data_seq;
+static size_t sack_mss;
+static uint32_t sack_drop;
+static uint32_t sack_sent;
+static uint32_t sack_delivered;
+static int sack_first_rexmit;
+static int sack_rexmits;
+static uint32_t sack_last_sent;
+
+/* Acknowledge the segments delivered in order, and report the runs of
+ * segments delivered after a hole in SACK blocks.
+ */
+static struct net_pkt *prepare_sack_ack_packet(sa_family_t af,
+					       uint16_t dst_port)
+{
+	uint8_t *block;
+	uint32_t start;
+	uint32_t end;
+	int blocks = 0;
+	int i = 0;
+
+	while (i < sack_segments && (sack_delivered & BIT(i))) {
+		i++;
+	}
+
+	ack = sack_data_seq + i * sack_mss;
+	sack_options_len = 0;
+
+	for ( ; i < sack_segments && blocks < NET_TCP_SACK_MAX_BLOCKS; i++) {
+		if (!(sack_delivered & BIT(i))) {
+			continue;
+		}
+
+		start = sack_data_seq + i * sack_mss;
+
+		while (i < sack_segments && (sack_delivered & BIT(i))) {
+			i++;
+		}
+
+		end = sack_data_seq + i * sack_mss;
+
+		block = &sack_options[4 + blocks * NET_TCP_SACK_BLOCK_SIZE];
+		UNALIGNED_PUT(htonl(start), (uint32_t *)block);
+		UNALIGNED_PUT(htonl(end), (uint32_t *)(block + 4));
+		blocks++;
+	}
+
+	if (blocks > 0) {
+		sack_options[0] = NET_TCP_NOP_OPT;
+		sack_options[1] = NET_TCP_NOP_OPT;
+		sack_options[2] = NET_TCP_SACK_OPT;
+		sack_options[3] = 2 + blocks * NET_TCP_SACK_BLOCK_SIZE;
+		sack_options_len = 4 + blocks * NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return prepare_ack_packet(af, htons(MY_PORT), dst_port);
+}
+
+static void handle_client_sack_test(struct net_pkt *pkt, struct tcphdr *th)
+{
+	sa_family_t af = net_pkt_family(pkt);
+	struct net_pkt *reply;
+	size_t len;
+	int idx;
+	int ret;
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(th, SYN);
+		seq = 0U;
+		ack = ntohl(th->th_seq) + 1U;
+		sack_data_seq = ack;
+
+		/* Accept the SACK permitted option of the SYN, with a small MSS */
+		sack_options[0] = NET_TCP_MSS_OPT;
+		sack_options[1] = NET_TCP_MSS_SIZE;
+		UNALIGNED_PUT(htons(SACK_PEER_MSS), (uint16_t *)&sack_options[2]);
+		sack_options[4] = NET_TCP_NOP_OPT;
+		sack_options[5] = NET_TCP_NOP_OPT;
+		sack_options[6] = NET_TCP_SACK_PERM_OPT;
+		sack_options[7] = NET_TCP_SACK_PERM_SIZE;
+		sack_options_len = NET_TCP_MSS_SIZE + NET_TCP_NOP_SIZE * 2 +
+				   NET_TCP_SACK_PERM_SIZE;
+
+		reply = prepare_syn_ack_packet(af, htons(MY_PORT),
+					       th->th_sport);
+		sack_options_len = 0;
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(th, ACK);
+		seq++;
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		test_verify_flags(th, PSH | ACK);
+
+		len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+		      net_pkt_ip_opts_len(pkt) - th->th_off * 4U;
+		zassert_equal(len, sack_mss, "Invalid segment length %zu", len);
+
+		idx = (ntohl(th->th_seq) - sack_data_seq) / sack_mss;
+		zassert_true(idx >= 0 && idx < sack_segments,
+			     "Invalid segment seq %u", ntohl(th->th_seq));
+
+		if (sack_sent & BIT(idx)) {
+			zassert_false(sack_delivered & BIT(idx),
+				      "Delivered segment %d sent again", idx);
+
+			if (sack_rexmits++ == 0) {
+				zassert_equal(idx, sack_first_rexmit,
+					      "Segment %d resent first", idx);
+			}
+
+			/* The retransmission timer would resend the first
+			 * unacknowledged segment, not later than this.
+			 */
+			zassert_true(k_uptime_get_32() - sack_last_sent <
+				     CONFIG_NET_TCP_INIT_RETRANSMISSION_TIMEOUT,
+				     "Segment %d resent by the RTO", idx);
+		} else {
+			sack_sent |= BIT(idx);
+			sack_last_sent = k_uptime_get_32();
+
+			if (sack_drop & BIT(idx)) {
+				/* Lost on the way */
+				return;
+			}
+		}
+
+		sack_delivered |= BIT(idx);
+		reply = prepare_sack_ack_packet(af, th->th_sport);
+
+		if (sack_delivered == BIT_MASK(sack_segments)) {
+			t_state = T_FIN;
+			test_sem_give();
+		}
+		break;
+	case T_FIN:
+		test_verify_flags(th, FIN | ACK);
+		ack = ack + 1U;
+		t_state = T_FIN_ACK;
+		reply = prepare_fin_ack_packet(af, htons(MY_PORT),
+					       th->th_sport);
+		break;
+	case T_FIN_ACK:
+		test_verify_flags(th, ACK);
+		test_sem_give();
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	ret = net_recv_data(net_iface, reply);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return;
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+static void test_client_sack(enum test_case_no test, int segments,
+			     uint32_t drop, int first_rexmit)
+{
+	struct net_context *ctx;
+	size_t len;
+	int ret;
+
+	t_state = T_SYN;
+	test_case_no = test;
+	seq = ack = 0;
+	sack_options_len = 0;
+	sack_segments = segments;
+	sack_drop = drop;
+	sack_sent = 0;
+	sack_delivered = 0;
+	sack_first_rexmit = first_rexmit;
+	sack_rexmits = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in),
+				  NULL,
+				  K_MSEC(100), NULL);
+	zassert_equal(ret, 0, "Failed to connect to peer");
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to SYN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	sack_mss = conn_mss((struct tcp *)ctx->tcp);
+	zassert_equal(sack_mss, SACK_PEER_MSS, "Invalid MSS %zu", sack_mss);
+	len = sack_segments * sack_mss;
+
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+	/* Let all the data be sent at once, as after slow start */
+	((struct tcp *)ctx->tcp)->ca.cwnd = len;
+#endif
+
+	ret = net_context_send(ctx, lorem_ipsum, len, NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, len, "Failed to send data to peer");
+
+	/* Peer will release the semaphore after it has received
+	 * all the data
+	 */
+	test_sem_take(K_MSEC(500), __LINE__);
+
+	zassert_true(sack_rexmits > 0, "No segment was resent");
+
+	net_context_put(ctx);
+
+	/* Peer will release the semaphore after it receives
+	 * proper ACK to FIN | ACK
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Connection is in TIME_WAIT state, context will be released
+	 * after K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY), so wait for it.
+	 */
+	k_sleep(K_MSEC(CONFIG_NET_TCP_TIME_WAIT_DELAY));
+}
+
+/* Test case scenario IPv4
+ *   send SYN,
+ *   expect SYN ACK with SACK permitted,
+ *   send ACK,
+ *   send 4 MSS of data, the second segment is lost,
+ *   send ACK for the first segment with SACK blocks for the others,
+ *   expect the second segment to be resent before the RTO expires,
+ *   send ACK for all the data,
+ *   send FIN,
+ *   expect FIN ACK,
+ *   send ACK.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_ipv4)
+{
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+		ztest_test_skip();
+	}
+
+	test_client_sack(TEST_CLIENT_SACK_IPV4, 4, BIT(1), 1);
+}
+
+/* Test case scenario IPv4
+ *   send SYN,
+ *   expect SYN ACK with SACK permitted,
+ *   send ACK,
+ *   send 13 MSS of data, segments 1 to 5 and 7 to 11 are lost,
+ *   send ACKs for the first segment with SACK blocks for the segments
+ *   6 and 12,
+ *   expect the lost segments to be resent in order before the RTO
+ *   expires: with congestion avoidance, the window halved on the loss
+ *   does not let them all be resent at once and the rest is resent as
+ *   the ACKs of the first ones come in,
+ *   send ACK for all the data,
+ *   send FIN,
+ *   expect FIN ACK,
+ *   send ACK.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_sack_holes_ipv4)
+{
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+		ztest_test_skip();
+	}
+
+	test_client_sack(TEST_CLIENT_SACK_IPV4, 13,
+			 GENMASK(5, 1) | GENMASK(11, 7), 1);
+}
+
+/* Test case scenario IPv4
+ *   send SYN,
+ *   expect SYN ACK with SACK permitted,
+ *   send ACK,
+ *   send 4 MSS of data, the last two segments are lost,
+ *   send ACK for the first two segments,
+ *   expect a tail loss probe resending the last segment before the
+ *   RTO expires,
+ *   send ACK with a SACK block for the last segment,
+ *   expect the third segment to be resent,
+ *   send ACK for all the data,
+ *   send FIN,
+ *   expect FIN ACK,
+ *   send ACK.
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_client_tlp_ipv4)
+{
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+		ztest_test_skip();
+	}
+
+	test_client_sack(TEST_CLIENT_TLP_IPV4, 4, BIT(2) | BIT(3), 3);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -653,4 +653,169 @@ ZTEST(udp_fn_tests, test_udp)
 	zassert_false(test_failed, "udp tests failed");
 }
 
+/* With the default CONFIG_NET_CONN_PORT_HASH_BITS these ports all share a
+ * bucket of the connection port index.
+ */
+#define INDEX_PORT 4242
+#define INDEX_PORT_SAME_BUCKET 4250
+#define INDEX_PORT_UNBOUND 4258
+
+static struct in_addr index_my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr index_peer_addr = { { { 192, 0, 2, 9 } } };
+
+static void index_register(struct ud *ud, const struct sockaddr *laddr,
+			   uint16_t rport, uint16_t lport,
+			   struct net_context *ctx, char *test)
+{
+	struct net_conn_handle *handle;
+	int ret;
+
+	ud->test = test;
+	ud->remote_addr = NULL;
+	ud->local_addr = laddr;
+	ud->remote_port = rport;
+	ud->local_port = lport;
+
+	ret = net_udp_register(AF_INET, NULL, laddr, rport, lport, ctx,
+			       test_ok, ud, &handle);
+	zassert_ok(ret, "UDP register %s failed (%d)", test, ret);
+
+	ud->handle = handle;
+}
+
+static void index_unregister(struct ud *ud)
+{
+	zassert_ok(net_udp_unregister(ud->handle), "UDP unregister %s failed",
+		   ud->test);
+}
+
+/* Check which handler, if any, gets a packet from the peer */
+static void index_check(struct net_if *iface, uint16_t rport, uint16_t lport,
+			struct ud *ud)
+{
+	returned_ud = NULL;
+
+	zassert_true(send_ipv4_udp_msg(iface, &index_peer_addr, &index_my_addr,
+				       rport, lport, ud, ud == NULL),
+		     "packet %u -> %u not delivered", rport, lport);
+	zassert_equal_ptr(returned_ud, ud, "packet %u -> %u delivered to %s",
+			  rport, lport,
+			  returned_ud != NULL ? returned_ud->test : "none");
+}
+
+static struct net_context *index_reuseport_context(void)
+{
+	struct net_context *ctx;
+	int one = 1;
+
+	zassert_ok(net_context_get(AF_INET, SOCK_DGRAM, IPPROTO_UDP, &ctx));
+	zassert_ok(net_context_set_option(ctx, NET_OPT_REUSEPORT, &one,
+					  sizeof(one)));
+
+	return ctx;
+}
+
+ZTEST(udp_fn_tests, test_udp_port_index)
+{
+	struct sockaddr_in my_addr4 = { .sin_family = AF_INET };
+	struct sockaddr_in my_port_addr4 = { .sin_family = AF_INET };
+	struct sockaddr_in peer_addr4 = { .sin_family = AF_INET };
+	struct net_context *ctx[3];
+	struct ud port_a, port_b, port_rport, any_port, updated;
+	struct ud reuse_port, reuse_any, reuse_newest;
+	struct net_if *iface;
+
+	if (IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE)) {
+		k_thread_priority_set(k_current_get(),
+				K_PRIO_COOP(CONFIG_NUM_COOP_PRIORITIES - 1));
+	} else {
+		k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(9));
+	}
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(net_if_ipv4_addr_add(iface, &index_my_addr,
+					      NET_ADDR_MANUAL, 0));
+	k_sem_init(&recv_lock, 0, UINT_MAX);
+
+	net_ipaddr_copy(&my_addr4.sin_addr, &index_my_addr);
+	net_ipaddr_copy(&my_port_addr4.sin_addr, &index_my_addr);
+	my_port_addr4.sin_port = htons(INDEX_PORT);
+	net_ipaddr_copy(&peer_addr4.sin_addr, &index_peer_addr);
+
+	/* Handlers on ports hashing to the same bucket stay apart */
+	index_register(&port_a, NULL, 0, INDEX_PORT, NULL, "port A");
+	index_register(&port_b, NULL, 0, INDEX_PORT_SAME_BUCKET, NULL, "port B");
+	index_register(&port_rport, NULL, 1234, INDEX_PORT, NULL,
+		       "port A from 1234");
+
+	index_check(iface, 1234, INDEX_PORT, &port_rport);
+	index_check(iface, 1235, INDEX_PORT, &port_a);
+	index_check(iface, 1234, INDEX_PORT_SAME_BUCKET, &port_b);
+	index_check(iface, 1234, INDEX_PORT_UNBOUND, NULL);
+
+	/* A handler bound to no port is checked along with the bucket, and
+	 * still ranked above handlers only bound to the port
+	 */
+	index_register(&any_port, (struct sockaddr *)&my_addr4, 1234, 0, NULL,
+		       "any port from 1234");
+
+	index_check(iface, 1234, INDEX_PORT, &any_port);
+	index_check(iface, 1235, INDEX_PORT, &port_a);
+	index_check(iface, 1234, INDEX_PORT_UNBOUND, &any_port);
+	index_check(iface, 1235, INDEX_PORT_UNBOUND, NULL);
+
+	index_unregister(&any_port);
+	index_unregister(&port_rport);
+
+	/* Updating a handler keeps it in its bucket */
+	updated = port_a;
+	updated.test = "port A updated";
+	zassert_ok(net_conn_update(port_a.handle, test_ok, &updated,
+				   (struct sockaddr *)&peer_addr4, 1234));
+
+	index_check(iface, 1234, INDEX_PORT, &updated);
+	index_check(iface, 1235, INDEX_PORT, NULL);
+	index_check(iface, 1234, INDEX_PORT_SAME_BUCKET, &port_b);
+
+	index_unregister(&port_a);
+	index_check(iface, 1235, INDEX_PORT, NULL);
+	index_check(iface, 1234, INDEX_PORT_SAME_BUCKET, &port_b);
+	index_unregister(&port_b);
+
+	/* Equally ranked SO_REUSEPORT handlers, one found through the bucket
+	 * and one bound to no port: the newest one wins, whichever list it
+	 * is in.
+	 */
+	for (int i = 0; i < ARRAY_SIZE(ctx); i++) {
+		ctx[i] = index_reuseport_context();
+	}
+
+	index_register(&reuse_port, (struct sockaddr *)&my_port_addr4, 0, 0,
+		       ctx[0], "reuseport in bucket");
+	index_register(&reuse_any, (struct sockaddr *)&my_addr4, 0, 0,
+		       ctx[1], "reuseport any port");
+	index_check(iface, 1234, INDEX_PORT, &reuse_any);
+
+	index_register(&reuse_newest, (struct sockaddr *)&my_port_addr4, 0, 0,
+		       ctx[2], "newest reuseport in bucket");
+	index_check(iface, 1234, INDEX_PORT, &reuse_newest);
+
+	index_unregister(&reuse_newest);
+	index_check(iface, 1234, INDEX_PORT, &reuse_any);
+
+	index_unregister(&reuse_any);
+	index_check(iface, 1234, INDEX_PORT, &reuse_port);
+
+	index_register(&reuse_any, (struct sockaddr *)&my_addr4, 0, 0,
+		       ctx[1], "reuseport any port again");
+	index_check(iface, 1234, INDEX_PORT, &reuse_any);
+
+	index_unregister(&reuse_any);
+	index_unregister(&reuse_port);
+
+	for (int i = 0; i < ARRAY_SIZE(ctx); i++) {
+		net_context_put(ctx[i]);
+	}
+}
+
 ZTEST_SUITE(udp_fn_tests, NULL, NULL, NULL, NULL, NULL);
@@ -117,6 +117,53 @@ ZTEST(posix_rw_locks, test_rw_lock)
 	zassert_ok(pthread_rwlock_destroy(&rwlock), "Failed to destroy rwlock");
 }
 
+static void *unlock_thread(void *p1)
+{
+	ARG_UNUSED(p1);
+
+	return INT_TO_POINTER(pthread_rwlock_unlock(&rwlock));
+}
+
+static void *write_thread(void *p1)
+{
+	ARG_UNUSED(p1);
+
+	zassert_ok(pthread_rwlock_wrlock(&rwlock), "Failed to acquire WR lock");
+	zassert_ok(pthread_rwlock_unlock(&rwlock), "Failed to unlock");
+
+	return NULL;
+}
+
+ZTEST(posix_rw_locks, test_rw_lock_recursive_read)
+{
+	pthread_t writer;
+	pthread_t other;
+	void *status;
+
+	zassert_ok(pthread_rwlock_init(&rwlock, NULL), "Failed to create rwlock");
+	zassert_ok(pthread_rwlock_rdlock(&rwlock), "Failed to acquire RD lock");
+
+	/* A thread that does not hold the lock cannot release it */
+	zassert_ok(pthread_create(&other, NULL, unlock_thread, NULL));
+	zassert_ok(pthread_join(other, &status), "Failed to join");
+	zassert_equal(POINTER_TO_INT(status), EPERM);
+
+	/* Let a writer wait for the lock */
+	zassert_ok(pthread_create(&writer, NULL, write_thread, NULL));
+	usleep(USEC_PER_MSEC);
+
+	/* The reader takes the lock again despite the waiting writer */
+	zassert_ok(pthread_rwlock_tryrdlock(&rwlock), "Failed to try RD lock again");
+	zassert_ok(pthread_rwlock_rdlock(&rwlock), "Failed to acquire RD lock again");
+
+	for (int i = 0; i < 3; i++) {
+		zassert_ok(pthread_rwlock_unlock(&rwlock), "Failed to unlock");
+	}
+
+	zassert_ok(pthread_join(writer, &status), "Failed to join");
+	zassert_ok(pthread_rwlock_destroy(&rwlock), "Failed to destroy rwlock");
+}
+
 static void test_pthread_rwlockattr_pshared_common(bool set, int pshared)
 {
 	int tmp_pshared = 4242;